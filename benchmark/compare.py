@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""
+Compares nanobench JSON results of benchmark suites.
+
+    compare.py baseline current [--threshold 0.05] [--overhead 0.5] [--allow-missing]
+
+baseline and current are JSON files written by suite executables or directories with such files.
+Results are matched by title and name. Script fails if any result of current is slower than
+baseline by more than threshold (plus measurement error of both results), or if any result of
+baseline is missing in current, unless --allow-missing is given (e.g. when the number of threads
+in case names differs between machines).
+
+With --overhead it also fails if any "constrained <case>" of current is slower than
+"manual <case>" with the same title by more than overhead.
+"""
+
+import argparse
+import json
+import sys
+from pathlib import Path
+
+
+def load(path):
+    files = sorted(path.glob("*.json")) if path.is_dir() else [path]
+    results = {}
+    for file in files:
+        with open(file) as f:
+            for r in json.load(f)["results"]:
+                results[(r["title"], r["name"])] = r
+    return results
+
+
+def time_per_unit(result):
+    return result["median(elapsed)"] / result["batch"]
+
+
+def error(result):
+    return result.get("medianAbsolutePercentError(elapsed)", 0.0)
+
+
+def format_time(seconds):
+    for unit, scale in (("s", 1.0), ("ms", 1e-3), ("us", 1e-6)):
+        if seconds >= scale:
+            return f"{seconds / scale:.2f} {unit}"
+    return f"{seconds / 1e-9:.2f} ns"
+
+
+def compare_runs(baseline, current, threshold, allow_missing):
+    regressions = []
+    print(f"{'title':<20} {'name':<55} {'baseline':>12} {'current':>12} {'change':>8}")
+    for key, result in current.items():
+        if key not in baseline:
+            continue
+        before = time_per_unit(baseline[key])
+        after = time_per_unit(result)
+        change = after / before - 1.0
+        allowed = threshold + error(baseline[key]) + error(result)
+        mark = " REGRESSION" if change > allowed else ""
+        print(f"{key[0]:<20} {key[1]:<55} {format_time(before):>12} {format_time(after):>12} {change:>+8.1%}{mark}")
+        if mark:
+            regressions.append(key)
+
+    missing = [key for key in baseline if key not in current]
+    for key in missing:
+        print(f"missing in current: {key[0]} / {key[1]}")
+    if not allow_missing:
+        regressions += missing
+    return regressions
+
+
+def compare_overhead(current, overhead):
+    regressions = []
+    print(f"\n{'title':<20} {'case':<55} {'manual':>12} {'constrained':>12} {'overhead':>8}")
+    for (title, name), result in current.items():
+        if not name.startswith("constrained "):
+            continue
+        case = name[len("constrained "):]
+        manual = current.get((title, "manual " + case))
+        if manual is None:
+            continue
+        before = time_per_unit(manual)
+        after = time_per_unit(result)
+        ratio = after / before - 1.0
+        mark = " OVERHEAD" if ratio > overhead else ""
+        print(f"{title:<20} {case:<55} {format_time(before):>12} {format_time(after):>12} {ratio:>+8.1%}{mark}")
+        if mark:
+            regressions.append((title, name))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare nanobench JSON results")
+    parser.add_argument("baseline", type=Path)
+    parser.add_argument("current", type=Path)
+    parser.add_argument("--threshold", type=float, default=0.05,
+                        help="allowed slowdown relative to baseline (default: 0.05)")
+    parser.add_argument("--overhead", type=float, default=None,
+                        help="allowed slowdown of constrained cases relative to manual ones")
+    parser.add_argument("--allow-missing", action="store_true",
+                        help="don't fail on baseline results missing in current")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    failed = compare_runs(baseline, current, args.threshold, args.allow_missing)
+    if args.overhead is not None:
+        failed += compare_overhead(current, args.overhead)
+
+    if failed:
+        print(f"\n{len(failed)} result(s) over threshold or missing")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
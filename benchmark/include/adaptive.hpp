@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace adaptive
+{
+    inline constexpr std::size_t phase_size = 16 * 1024;
+    inline constexpr std::size_t phases = 3;
+    inline constexpr std::size_t size = phase_size * phases;
+
+    /*
+     * Bit I of value rejects it by constraint I
+     * Phase I rejects 90% of values by constraint I, so the best order changes with input
+     */
+    inline auto make_data() -> std::vector<std::uint32_t>
+    {
+        nb::Rng gen{23};
+        std::vector<std::uint32_t> data(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            auto const phase = i / phase_size;
+            auto x = static_cast<std::uint32_t>(gen()) & ~std::uint32_t{0b111};
+            if (gen.bounded(10) != 0)
+                x |= std::uint32_t{1} << phase;
+            data[i] = x;
+        }
+        return data;
+    }
+
+    // Rejects values with bit Bit set after Rounds rounds of work
+    template <unsigned Bit, unsigned Rounds>
+    constexpr auto costly_bit = [](std::uint32_t x) {
+        std::uint32_t h = x;
+        for (unsigned i = 0; i < Rounds; ++i)
+            h = h * 2654435761U + i;
+        return (x >> Bit & 1) == 0 or h == 0;
+    };
+
+    constexpr auto cheap = costly_bit<0, 1>;
+    constexpr auto medium = costly_bit<1, 16>;
+    constexpr auto expensive = costly_bit<2, 128>;
+
+    struct traits
+    {
+        using value_type = std::uint32_t;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = 0;
+    };
+
+    using ordered_t = ct::basic_constrained_type<std::uint32_t, traits, ct::configuration_point{}, cheap, medium, expensive>;
+    using adaptive_t = ct::basic_constrained_type<std::uint32_t, traits, ct::configuration_point{}, ct::adaptive_and<cheap, medium, expensive>>;
+}
+
+namespace manual::adaptive
+{
+    inline void run(std::vector<std::uint32_t> const & data)
+    {
+        std::uint32_t sum = 0;
+        for (auto x : data)
+        {
+            if (::adaptive::cheap(x) and ::adaptive::medium(x) and ::adaptive::expensive(x))
+                sum += x;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
+
+namespace constrained::adaptive
+{
+    template <typename C>
+    void run(std::vector<std::uint32_t> const & data)
+    {
+        std::uint32_t sum = 0;
+        for (auto x : data)
+        {
+            C const c{x};
+            if (c)
+                sum += *c;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace bounded
+{
+    inline constexpr std::size_t size = 4096;
+
+    using percent_t = ct::bounded<int, 0, 100>;
+    using bonus_t = ct::bounded<int, 0, 50>;
+    using weight_t = ct::constrained_type<int, ct::ge<1>, ct::le<10>>;
+    using billed_t = ct::bounded<int, 0, 1000>;
+
+    struct raw_sample
+    {
+        int reading;
+        int bonus;
+        int weight;
+    };
+
+    struct sample
+    {
+        percent_t reading;
+        bonus_t bonus;
+        weight_t weight;
+    };
+
+    inline auto make_raw_data() -> std::vector<raw_sample>
+    {
+        nb::Rng gen{83};
+        std::vector<raw_sample> data(size);
+        for (auto & x : data)
+        {
+            x.reading = static_cast<int>(gen.bounded(101));
+            x.bonus = static_cast<int>(gen.bounded(51));
+            x.weight = static_cast<int>(gen.bounded(10)) + 1;
+        }
+        return data;
+    }
+
+    inline auto make_data(std::vector<raw_sample> const & raw) -> std::vector<sample>
+    {
+        std::vector<sample> data;
+        data.reserve(raw.size());
+        for (auto const & x : raw)
+            data.push_back({percent_t{x.reading}, bonus_t{x.bonus}, weight_t{x.weight}});
+        return data;
+    }
+}
+
+namespace manual::bounded
+{
+    // No invariants, bounds are kept in mind
+    inline void run(std::vector<::bounded::raw_sample> const & data)
+    {
+        int sum = 0;
+        for (auto const & x : data)
+            sum += std::clamp((x.reading + x.bonus) * x.weight, 0, 1000);
+        nb::doNotOptimizeAway(sum);
+    }
+}
+
+namespace constrained::rewrap::bounded
+{
+    // Every intermediate result is unwrapped and checked again
+    inline void run(std::vector<::bounded::sample> const & data)
+    {
+        int sum = 0;
+        for (auto const & x : data)
+        {
+            ct::bounded<int, 0, 150> const usage{*x.reading + *x.bonus};
+            ct::bounded<int, 0, 1500> const cost{*usage * *x.weight};
+            ::bounded::billed_t const billed{std::clamp(*cost, 0, 1000)};
+            sum += *billed;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
+
+namespace constrained::bounded
+{
+    // Result bounds are computed at compile time, nothing is checked
+    inline void run(std::vector<::bounded::sample> const & data)
+    {
+        int sum = 0;
+        for (auto const & x : data)
+        {
+            ::bounded::billed_t const billed = ct::clamp<0, 1000>((x.reading + x.bonus) * x.weight);
+            sum += *billed;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace branchless
+{
+    inline constexpr std::size_t size = 4096;
+
+    // Each value fails constraints with probability of failure_percent
+    inline auto make_data(unsigned failure_percent) -> std::vector<int>
+    {
+        nb::Rng gen{failure_percent + 1};
+        std::vector<int> data(size);
+        for (auto & x : data)
+        {
+            if (gen.bounded(100) < failure_percent)
+                x = gen.bounded(2) ? -static_cast<int>(gen.bounded(1000)) : 1000 + static_cast<int>(gen.bounded(1000));
+            else
+                x = 1 + static_cast<int>(gen.bounded(998));
+        }
+        return data;
+    }
+
+    struct traits
+    {
+        using value_type = int;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = -1;
+    };
+
+    constexpr auto short_circuit = ct::configuration_point{};
+    constexpr auto branchless_checks = ct::configuration_point{.branchless_checks = true};
+
+    template <ct::configuration_point Config>
+    using range_t = ct::basic_constrained_type<int, traits, Config,
+        ct::gt<0>, ct::lt<1000>
+    >;
+
+    using or_t = ct::basic_constrained_type<int, traits, short_circuit,
+        ct::or_<ct::and_<ct::gt<0>, ct::lt<500>>, ct::and_<ct::ge<500>, ct::lt<1000>>>
+    >;
+
+    using branchless_or_t = ct::basic_constrained_type<int, traits, short_circuit,
+        ct::branchless_or<ct::branchless_and<ct::gt<0>, ct::lt<500>>, ct::branchless_and<ct::ge<500>, ct::lt<1000>>>
+    >;
+
+    using if_t = ct::basic_constrained_type<int, traits, short_circuit,
+        ct::if_<ct::lt<500>, ct::gt<0>, ct::lt<1000>>
+    >;
+
+    using branchless_if_t = ct::basic_constrained_type<int, traits, short_circuit,
+        ct::branchless_if<ct::lt<500>, ct::gt<0>, ct::lt<1000>>
+    >;
+}
+
+namespace manual::branchless
+{
+    inline void run(std::vector<int> const & data)
+    {
+        int sum = 0;
+        for (auto x : data)
+        {
+            if (x > 0 && x < 1000)
+                sum += x;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
+
+namespace constrained::branchless
+{
+    template <typename C>
+    void run(std::vector<int> const & data)
+    {
+        int sum = 0;
+        for (auto x : data)
+        {
+            C const c{x};
+            if (c)
+                sum += *c;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace bulk_validate
+{
+    inline constexpr std::size_t size = 1'000'000;
+
+    // Roughly 10% of values fail [0, 1000) range check
+    template <typename T>
+    auto make_data() -> std::vector<T>
+    {
+        nb::Rng gen{42};
+        std::vector<T> data(size);
+        for (auto & x : data)
+            x = static_cast<T>(gen.bounded(1100)) - static_cast<T>(50);
+        return data;
+    }
+
+    template <typename T>
+    struct traits
+    {
+        using value_type = T;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = -1;
+    };
+
+    template <typename T>
+    using range_t = ct::basic_constrained_type<T, traits<T>, ct::configuration_point{},
+        ct::ge<0>, ct::lt<1000>
+    >;
+
+    constexpr auto is_even = [](auto x) { return static_cast<long long>(x) % 2 == 0; };
+
+    template <typename T>
+    using lambda_t = ct::basic_constrained_type<T, traits<T>, ct::configuration_point{},
+        ct::ge<0>, is_even
+    >;
+}
+
+namespace constrained::per_element::bulk_validate
+{
+    using namespace ::bulk_validate;
+
+    template <typename C>
+    void run(std::vector<typename C::value_type> const & data)
+    {
+        std::size_t failures = 0;
+        for (auto x : data)
+            failures += not static_cast<bool>(C{x});
+        nb::doNotOptimizeAway(failures);
+    }
+}
+
+namespace constrained::bulk::bulk_validate
+{
+    using namespace ::bulk_validate;
+
+    template <typename C>
+    void run_mask(std::vector<typename C::value_type> const & data)
+    {
+        nb::doNotOptimizeAway(ct::validate<C>(data).failures());
+    }
+
+    template <typename C>
+    void run_first(std::vector<typename C::value_type> const & data)
+    {
+        nb::doNotOptimizeAway(ct::validate_first<C>(data));
+    }
+
+    template <typename C>
+    void run_partition(std::vector<typename C::value_type> & data)
+    {
+        nb::doNotOptimizeAway(ct::validate_partition<C>(data));
+    }
+}
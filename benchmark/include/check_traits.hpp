@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace check_traits
+{
+    inline constexpr std::size_t size = 4096;
+
+    // Values in [0, 1000), failure_permille of them are out of range
+    inline auto make_data(unsigned failure_permille) -> std::vector<int>
+    {
+        nb::Rng gen{53};
+        std::vector<int> data(size);
+        for (auto & x : data)
+        {
+            x = static_cast<int>(gen.bounded(1000));
+            if (gen.bounded(1000) < failure_permille)
+                x = -x - 1;
+        }
+        return data;
+    }
+
+    struct nullable_traits
+    {
+        using value_type = int;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = -1;
+    };
+
+    struct throwing_traits
+    {
+        using value_type = int;
+        static constexpr bool is_nullable = false;
+    };
+
+    using nullable_t = ct::basic_constrained_type<int, nullable_traits, ct::configuration_point{}, ct::ge<0>, ct::lt<1000>>;
+    using throwing_t = ct::basic_constrained_type<int, throwing_traits, ct::configuration_point{}, ct::ge<0>, ct::lt<1000>>;
+}
+
+namespace manual::check_traits
+{
+    inline void run_nullable(std::vector<int> const & data)
+    {
+        int sum = 0;
+        for (auto x : data)
+        {
+            int const value = x >= 0 && x < 1000 ? x : -1;
+            if (value != -1)
+                sum += value;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+
+    inline void run_throwing(std::vector<int> const & data)
+    {
+        int sum = 0;
+        for (auto x : data)
+        {
+            try
+            {
+                if (!(x >= 0 && x < 1000))
+                    throw std::logic_error{"Constraints not satisfied"};
+                sum += x;
+            }
+            catch (std::logic_error const &) {}
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
+
+namespace constrained::check_traits
+{
+    inline void run_nullable(std::vector<int> const & data)
+    {
+        int sum = 0;
+        for (auto x : data)
+        {
+            ::check_traits::nullable_t const c{x};
+            if (c)
+                sum += *c;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+
+    inline void run_throwing(std::vector<int> const & data)
+    {
+        int sum = 0;
+        for (auto x : data)
+        {
+            try
+            {
+                ::check_traits::throwing_t const c{x};
+                sum += *c;
+            }
+            catch (std::logic_error const &) {}
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace check_view
+{
+    inline constexpr std::size_t count = 1 << 14;
+
+    // Usernames from untrusted input, most of them are too long or contain invalid characters
+    inline auto make_data() -> std::vector<std::string>
+    {
+        nb::Rng gen{109};
+        std::vector<std::string> data;
+        data.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::string name(8 + gen.bounded(56), 'a');
+            for (auto & c : name)
+                c = static_cast<char>('a' + gen.bounded(26));
+            if (gen.bounded(4) != 0)
+                name[gen.bounded(static_cast<std::uint32_t>(name.size()))] = '-';
+            data.push_back(std::move(name));
+        }
+        return data;
+    }
+
+    struct traits
+    {
+        using value_type = std::string;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = {};
+    };
+
+    struct viewed_traits
+    {
+        using value_type = std::string;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = {};
+        using check_view_type = std::string_view;
+    };
+
+    template <bool Viewed>
+    using username_t = ct::basic_constrained_type<std::string, std::conditional_t<Viewed, viewed_traits, traits>, ct::configuration_point{},
+        ct::length_in<3, 32>,
+        ct::charset<"a-z0-9_">
+    >;
+}
+
+namespace manual::check_view
+{
+    // Input is checked as string_view, only accepted names are copied
+    inline void run(std::vector<std::string> const & data, std::vector<std::string> & out)
+    {
+        out.clear();
+        for (std::string_view name : data)
+        {
+            bool valid = name.size() >= 3 and name.size() <= 32;
+            for (std::size_t i = 0; valid and i < name.size(); ++i)
+            {
+                auto const c = name[i];
+                valid = (c >= 'a' and c <= 'z') or (c >= '0' and c <= '9') or c == '_';
+            }
+            out.emplace_back(valid ? std::string{name} : std::string{});
+        }
+        nb::doNotOptimizeAway(out.data());
+    }
+}
+
+namespace constrained::check_view
+{
+    // Viewed = false copies every name before the check, rejected copies are replaced with null
+    template <bool Viewed>
+    inline void run(std::vector<std::string> const & data, std::vector<::check_view::username_t<Viewed>> & out)
+    {
+        out.clear();
+        for (auto const & name : data)
+            out.emplace_back(name);
+        nb::doNotOptimizeAway(out.data());
+    }
+}
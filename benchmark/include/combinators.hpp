@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace combinators
+{
+    inline constexpr std::size_t size = 4096;
+
+    inline auto make_data() -> std::vector<int>
+    {
+        nb::Rng gen{29};
+        std::vector<int> data(size);
+        for (auto & x : data)
+            x = static_cast<int>(gen.bounded(2001)) - 1000;
+        return data;
+    }
+
+    struct traits
+    {
+        using value_type = int;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = std::numeric_limits<int>::min();
+    };
+
+    template <auto... Constraints>
+    using constrained_t = ct::basic_constrained_type<int, traits, ct::configuration_point{}, Constraints...>;
+}
+
+namespace manual::combinators
+{
+    template <typename Predicate>
+    void run(std::vector<int> const & data, Predicate predicate)
+    {
+        int sum = 0;
+        for (auto x : data)
+        {
+            if (predicate(x))
+                sum += x;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
+
+namespace constrained::combinators
+{
+    template <typename C>
+    void run(std::vector<int> const & data)
+    {
+        int sum = 0;
+        for (auto x : data)
+        {
+            C const c{x};
+            if (c)
+                sum += *c;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
+
+namespace combinators
+{
+    // Runs hand-written predicate and constrained type C with equivalent constraints on the same data
+    template <typename C, typename Predicate>
+    void add_case(nb::Bench & bench, std::string const & name, std::vector<int> const & data, Predicate predicate)
+    {
+        bench
+            .run("manual " + name, [&]{
+                manual::combinators::run(data, predicate);
+            })
+            .run("constrained " + name, [&]{
+                constrained::combinators::run<C>(data);
+            });
+    }
+}
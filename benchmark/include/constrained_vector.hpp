@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace constrained_vector
+{
+    inline constexpr std::size_t size = 1024;
+    inline constexpr std::size_t block = 64;
+
+    inline auto make_data() -> std::vector<int>
+    {
+        nb::Rng gen{61};
+        std::vector<int> data(size);
+        for (auto & x : data)
+            x = static_cast<int>(gen.bounded(1000)) + 1;
+        return data;
+    }
+
+    constexpr auto all_in_range = [](std::vector<int> const & xs) {
+        return std::ranges::all_of(xs, [](int x) { return x > 0 and x <= 1000; });
+    };
+
+    // Whole vector as constrained value, every change rechecks all elements
+    using rewrapped_t = ct::constrained_type<std::vector<int>, all_in_range>;
+
+    using vector_t = ct::constrained_vector<int, ct::gt<0>, ct::le<1000>>;
+}
+
+namespace manual::constrained_vector
+{
+    inline void run_push_back(std::vector<int> const & data)
+    {
+        std::vector<int> values;
+        for (auto x : data)
+        {
+            if (!(x > 0 && x <= 1000))
+                throw std::logic_error{"Constraints not satisfied"};
+            values.push_back(x);
+        }
+        nb::doNotOptimizeAway(values);
+    }
+}
+
+namespace constrained::constrained_vector
+{
+    inline void run_rewrap(std::vector<int> const & data)
+    {
+        ::constrained_vector::rewrapped_t values{std::vector<int>{}};
+        for (auto x : data)
+        {
+            auto raw = *std::move(values);
+            raw.push_back(x);
+            values = ::constrained_vector::rewrapped_t{std::move(raw)};
+        }
+        nb::doNotOptimizeAway(values);
+    }
+
+    inline void run_push_back(std::vector<int> const & data)
+    {
+        ::constrained_vector::vector_t values;
+        for (auto x : data)
+            values.push_back(x);
+        nb::doNotOptimizeAway(values);
+    }
+
+    // Blocks are checked by bulk kernels
+    inline void run_append_range(std::vector<int> const & data)
+    {
+        ::constrained_vector::vector_t values;
+        std::span<int const> const all = data;
+        for (std::size_t i = 0; i < all.size(); i += ::constrained_vector::block)
+            values.append_range(all.subspan(i, std::min(::constrained_vector::block, all.size() - i)));
+        nb::doNotOptimizeAway(values);
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace instrumentation
+{
+    inline constexpr std::size_t size = 4096;
+
+    inline auto make_data() -> std::vector<int>
+    {
+        nb::Rng gen{19};
+        std::vector<int> data(size);
+        for (auto & x : data)
+            x = static_cast<int>(gen.bounded(1100)) - 50;
+        return data;
+    }
+
+    struct traits
+    {
+        using value_type = int;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = -1;
+    };
+
+    template <ct::configuration_point Config>
+    using range_t = ct::basic_constrained_type<int, traits, Config, ct::ge<0>, ct::lt<1000>>;
+
+    using plain_t = range_t<ct::configuration_point{.instrumented = false}>;
+    using counted_t = range_t<ct::configuration_point{.instrumented = true}>;
+    using timed_t = range_t<ct::configuration_point{.instrumented = true, .cycle_sample_rate = 64}>;
+}
+
+namespace constrained::instrumentation
+{
+    template <typename C>
+    void run(std::vector<int> const & data)
+    {
+        int sum = 0;
+        for (auto x : data)
+        {
+            C const c{x};
+            if (c)
+                sum += *c;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
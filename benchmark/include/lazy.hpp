@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace lazy
+{
+    inline constexpr std::size_t requests = 1024;
+    inline constexpr std::size_t fields = 32;
+
+    using raw_request = std::array<std::int64_t, fields>;
+
+    inline auto make_data() -> std::vector<raw_request>
+    {
+        nb::Rng gen{17};
+        std::vector<raw_request> data(requests);
+        for (auto & request : data)
+        {
+            for (auto & field : request)
+                field = static_cast<std::int64_t>(gen.bounded(1'000'000'000));
+        }
+        return data;
+    }
+
+    struct traits
+    {
+        using value_type = std::int64_t;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = -1;
+    };
+
+    // Luhn checksum of decimal digits, like in account or card numbers
+    constexpr auto luhn = [](std::int64_t x) {
+        std::int64_t sum = 0;
+        bool twice = false;
+        for (; x > 0; x /= 10, twice = not twice)
+        {
+            auto digit = x % 10;
+            if (twice)
+                digit = digit * 2 > 9 ? digit * 2 - 9 : digit * 2;
+            sum += digit;
+        }
+        return sum % 10 == 0;
+    };
+
+    template <ct::check_policy Policy>
+    using field_t = ct::basic_constrained_type<
+        std::int64_t, traits, ct::configuration_point{.check_policy = Policy},
+        ct::ge<0>, ct::lt<1'000'000'000>, luhn
+    >;
+
+    using eager_t = field_t<ct::check_policy::always>;
+    using lazy_t = field_t<ct::check_policy::lazy>;
+}
+
+namespace manual::lazy
+{
+    // Checks only fields, which are read
+    inline void run(std::vector<::lazy::raw_request> const & data, std::size_t touched)
+    {
+        std::int64_t sum = 0;
+        for (auto const & request : data)
+        {
+            for (std::size_t i = 0; i < touched; ++i)
+            {
+                auto const x = request[i];
+                if (x >= 0 and x < 1'000'000'000 and ::lazy::luhn(x))
+                    sum += x;
+            }
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
+
+namespace constrained::lazy
+{
+    template <typename C>
+    auto make_request(::lazy::raw_request const & raw) -> std::array<C, ::lazy::fields>
+    {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            return std::array<C, ::lazy::fields>{C{raw[Is]}...};
+        }(std::make_index_sequence<::lazy::fields>{});
+    }
+
+    template <typename C>
+    void run(std::vector<::lazy::raw_request> const & data, std::size_t touched)
+    {
+        std::int64_t sum = 0;
+        for (auto const & raw : data)
+        {
+            auto const request = make_request<C>(raw);
+            nb::doNotOptimizeAway(request);
+
+            for (std::size_t i = 0; i < touched; ++i)
+            {
+                if (request[i])
+                    sum += *request[i];
+            }
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+
+    template <typename C>
+    void run_validate_all(std::vector<::lazy::raw_request> const & data)
+    {
+        std::int64_t sum = 0;
+        for (auto const & raw : data)
+        {
+            auto const request = make_request<C>(raw);
+
+            for (auto const & field : request)
+                field.validate_all();
+            for (auto const & field : request)
+            {
+                if (field)
+                    sum += *field;
+            }
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace lookup
+{
+    inline constexpr std::size_t keys = 1 << 16;
+    inline constexpr std::size_t queries = 4096;
+
+    using id_t = ct::constrained_type<int, ct::in_range<1, 1'000'000>>;
+    using name_t = ct::constrained_type<std::string, ct::length_in<1, 32>, ct::charset<"a-zA-Z0-9_">>;
+
+    template <typename Key>
+    using wrapping_map = std::unordered_map<Key, int>;
+
+    template <typename Key>
+    using transparent_map = std::unordered_map<Key, int, ct::transparent_hash<Key>, ct::transparent_equal<Key>>;
+
+    /*
+     * Names are identifiers of 8 to 32 characters, so most of them don't fit in small string buffer
+     * Queries are views into a network buffer, every second query misses
+     */
+    struct data
+    {
+        std::vector<int> ids;
+        std::vector<int> id_queries;
+
+        std::vector<std::string> names;
+        std::string buffer;
+        std::vector<std::string_view> name_queries;
+    };
+
+    inline auto make_data() -> data
+    {
+        static constexpr std::string_view alphabet = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_";
+
+        nb::Rng gen{89};
+        auto make_name = [&gen]{
+            std::string name(8 + gen.bounded(25), ' ');
+            for (auto & c : name)
+                c = alphabet[gen.bounded(alphabet.size())];
+            return name;
+        };
+
+        data result;
+        for (std::size_t i = 0; i < keys; ++i)
+        {
+            result.ids.push_back(static_cast<int>(gen.bounded(1'000'000)) + 1);
+            result.names.push_back(make_name());
+        }
+
+        std::vector<std::string> queried;
+        for (std::size_t i = 0; i < queries; ++i)
+        {
+            bool const hit = i % 2 == 0;
+            result.id_queries.push_back(hit ? result.ids[gen.bounded(keys)] : static_cast<int>(gen.bounded(1'000'000)) + 1);
+            queried.push_back(hit ? result.names[gen.bounded(keys)] : make_name());
+        }
+
+        for (auto const & name : queried)
+            result.buffer += name;
+        std::size_t offset = 0;
+        for (auto const & name : queried)
+        {
+            result.name_queries.push_back(std::string_view{result.buffer}.substr(offset, name.size()));
+            offset += name.size();
+        }
+        return result;
+    }
+
+    template <typename Map>
+    auto make_id_map(data const & d) -> Map
+    {
+        Map map;
+        for (std::size_t i = 0; i < d.ids.size(); ++i)
+            map.emplace(id_t{d.ids[i]}, static_cast<int>(i));
+        return map;
+    }
+
+    template <typename Map>
+    auto make_name_map(data const & d) -> Map
+    {
+        Map map;
+        for (std::size_t i = 0; i < d.names.size(); ++i)
+            map.emplace(name_t{d.names[i]}, static_cast<int>(i));
+        return map;
+    }
+}
+
+namespace constrained::wrap::lookup
+{
+    // Every query is wrapped, so constraints are checked and strings are copied before lookup
+    template <typename Map>
+    void run_ids(Map const & map, std::vector<int> const & queries)
+    {
+        int sum = 0;
+        for (auto x : queries)
+        {
+            if (auto it = map.find(::lookup::id_t{x}); it != map.end())
+                sum += it->second;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+
+    template <typename Map>
+    void run_names(Map const & map, std::vector<std::string_view> const & queries)
+    {
+        int sum = 0;
+        for (auto x : queries)
+        {
+            if (auto it = map.find(::lookup::name_t{std::string{x}}); it != map.end())
+                sum += it->second;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
+
+namespace constrained::lookup
+{
+    // Raw queries are hashed and compared as they are
+    template <typename Map, typename Query>
+    void run(Map const & map, std::vector<Query> const & queries)
+    {
+        int sum = 0;
+        for (auto x : queries)
+        {
+            if (auto it = map.find(x); it != map.end())
+                sum += it->second;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
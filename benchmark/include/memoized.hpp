@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace memoized
+{
+    inline constexpr std::size_t size = 4096;
+    inline constexpr std::size_t distinct_keys = 10'000;
+
+    // Tenant-like identifiers long enough to make charset scan noticeable
+    inline auto make_keys() -> std::vector<std::string>
+    {
+        nb::Rng gen{11};
+        std::vector<std::string> keys(distinct_keys);
+        for (auto & key : keys)
+        {
+            key = "tenant-";
+            for (std::size_t i = 0; i < 57; ++i)
+                key += static_cast<char>('a' + gen.bounded(26));
+        }
+        return keys;
+    }
+
+    // Samples keys with probability proportional to 1 / rank^exponent
+    inline auto make_data(std::vector<std::string> const & keys, double exponent) -> std::vector<std::string>
+    {
+        std::vector<double> cdf(keys.size());
+        double sum = 0;
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            sum += 1.0 / std::pow(static_cast<double>(i + 1), exponent);
+            cdf[i] = sum;
+        }
+
+        nb::Rng gen{13};
+        std::vector<std::string> data(size);
+        for (auto & x : data)
+        {
+            auto const rank = std::lower_bound(cdf.begin(), cdf.end(), gen.uniform01() * sum) - cdf.begin();
+            x = keys[std::min(static_cast<std::size_t>(rank), keys.size() - 1)];
+        }
+        return data;
+    }
+
+    struct traits
+    {
+        using value_type = std::string;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = {};
+    };
+
+    inline auto reserved() -> std::set<std::string> const &
+    {
+        static auto const names = []{
+            auto keys = make_keys();
+            std::set<std::string> result;
+            for (std::size_t i = 0; i < keys.size(); i += 10)
+                result.insert(keys[i] + "-reserved");
+            return result;
+        }();
+        return names;
+    }
+
+    // Charset scan followed by lookup in reserved names
+    inline auto is_identifier(std::string const & s) -> bool
+    {
+        if (s.empty() or s.size() > 64)
+            return false;
+        bool const charset = std::all_of(s.begin(), s.end(), [](char c) {
+            return (c >= 'a' and c <= 'z') or (c >= '0' and c <= '9') or c == '-' or c == '_';
+        });
+        return charset and not reserved().contains(s);
+    }
+
+    constexpr auto identifier = [](std::string const & s) { return is_identifier(s); };
+
+    using plain_t = ct::basic_constrained_type<std::string, traits, ct::configuration_point{}, identifier>;
+    using memoized_t = ct::basic_constrained_type<std::string, traits, ct::configuration_point{}, ct::memoized<identifier, 1024>>;
+}
+
+namespace manual::memoized
+{
+    inline void run(std::vector<std::string> const & data)
+    {
+        std::size_t valid = 0;
+        for (auto const & x : data)
+            valid += ::memoized::is_identifier(x);
+        nb::doNotOptimizeAway(valid);
+    }
+}
+
+namespace constrained::memoized
+{
+    template <typename C>
+    void run(std::vector<std::string> const & data)
+    {
+        std::size_t valid = 0;
+        for (auto const & x : data)
+        {
+            C const c{x};
+            valid += static_cast<bool>(c);
+        }
+        nb::doNotOptimizeAway(valid);
+    }
+}
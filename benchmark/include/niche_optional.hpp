@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace niche_optional
+{
+    // Large enough to miss cache
+    inline constexpr std::size_t size = 1 << 22;
+
+    using id_t = ct::constrained_type<int, ct::gt<0>>;
+
+    // Every fourth id is missing
+    inline auto make_data() -> std::vector<int>
+    {
+        nb::Rng gen{97};
+        std::vector<int> data(size);
+        for (auto & x : data)
+            x = gen.bounded(4) == 0 ? 0 : static_cast<int>(gen.bounded(1'000'000)) + 1;
+        return data;
+    }
+
+    template <typename Optional>
+    auto make_cache(std::vector<int> const & data) -> std::vector<Optional>
+    {
+        std::vector<Optional> cache(data.size());
+        for (std::size_t i = 0; i < data.size(); ++i)
+        {
+            if (data[i] != 0)
+                cache[i] = id_t{data[i]};
+        }
+        return cache;
+    }
+}
+
+namespace manual::niche_optional
+{
+    // 0 marks missing id by convention
+    inline void run(std::vector<int> const & cache)
+    {
+        long long sum = 0;
+        for (auto x : cache)
+        {
+            if (x != 0)
+                sum += x;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
+
+namespace constrained::niche_optional
+{
+    template <typename Optional>
+    void run(std::vector<Optional> const & cache)
+    {
+        long long sum = 0;
+        for (auto const & x : cache)
+        {
+            if (x)
+                sum += **x;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
@@ -115,3 +115,86 @@ namespace constrained::throwing::non_null
         } catch(std::logic_error const &) {}
     }
 }
+
+namespace constrained::expected::non_null
+{
+    template <typename T>
+    using non_null = constrained::throwing::non_null::non_null<T>;
+
+    template <typename T>
+    void run()
+    {
+        T x{};
+        auto ptr = ct::try_make<non_null<T>>(rng() % 2 ? &x : nullptr);
+        if (ptr)
+            nb::doNotOptimizeAway(**ptr);
+        else
+            nb::doNotOptimizeAway(ptr.error().index);
+    }
+}
+
+namespace manual::raw::non_null
+{
+    template <typename T>
+    auto dereference(T *x)
+    {
+        return *x;
+    }
+
+    template <typename T>
+    void run()
+    {
+        T x{};
+        T *ptr = &x;
+        nb::doNotOptimizeAway(ptr);
+        nb::doNotOptimizeAway(dereference<T>(ptr));
+    }
+}
+
+namespace constrained::trusted::non_null
+{
+    template <typename T>
+    using non_null = constrained::throwing::non_null::non_null<T>;
+
+    template <typename T>
+    void run()
+    {
+        T x{};
+        T *ptr = &x;
+        nb::doNotOptimizeAway(ptr);
+        nb::doNotOptimizeAway(*non_null<T>{ct::trusted, ptr});
+    }
+}
+
+namespace constrained::sampled::non_null
+{
+    template <typename T>
+    using non_null = ct::basic_constrained_type<T*, constrained::throwing::non_null::traits<T*>,
+        ct::configuration_point{.check_policy = ct::check_policy::sampled, .sample_rate = 64},
+        ct::neq<nullptr>
+    >;
+
+    template <typename T>
+    void run()
+    {
+        T x{};
+        T *ptr = &x;
+        nb::doNotOptimizeAway(ptr);
+        nb::doNotOptimizeAway(*non_null<T>{ptr});
+    }
+}
+
+namespace constrained::always::non_null
+{
+    template <typename T>
+    using non_null = constrained::throwing::non_null::non_null<T>;
+
+    template <typename T>
+    void run()
+    {
+        T x{};
+        T *ptr = &x;
+        nb::doNotOptimizeAway(ptr);
+        nb::doNotOptimizeAway(*non_null<T>{ptr});
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace normalized_pack
+{
+    inline constexpr std::size_t size = 4096;
+
+    inline auto make_data() -> std::vector<int>
+    {
+        nb::Rng gen{7};
+        std::vector<int> data(size);
+        for (auto & x : data)
+            x = static_cast<int>(gen.bounded(120)) - 10;
+        return data;
+    }
+
+    struct traits
+    {
+        using value_type = int;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = -1;
+    };
+
+    constexpr auto is_odd = [](int x) { return x % 2 != 0; };
+
+    // Pack produced by a deep add_constraints hierarchy
+    using base_t = ct::basic_constrained_type<int, traits, ct::configuration_point{}, ct::gt<0>, is_odd>;
+    using middle_t = base_t::add_constraints<ct::gt<5>, ct::lt<100>>;
+    using redundant_t = middle_t::add_constraints<ct::lt<42>, ct::gt<0>, is_odd>;
+
+    using normalized_t = redundant_t::normalize_constraints;
+
+    using normalized_config_t = ct::set_constraint_pack<
+        ct::basic_constrained_type<int, traits, ct::configuration_point{.normalize_constraints = true}>,
+        redundant_t::constraint_pack
+    >;
+}
+
+namespace manual::normalized_pack
+{
+    inline void run(std::vector<int> const & data)
+    {
+        int sum = 0;
+        for (auto x : data)
+        {
+            if (x > 5 && x < 42 && x % 2 != 0)
+                sum += x;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
+
+namespace constrained::normalized_pack
+{
+    template <typename C>
+    void run(std::vector<int> const & data)
+    {
+        int sum = 0;
+        for (auto x : data)
+        {
+            C const c{x};
+            if (c)
+                sum += *c;
+        }
+        nb::doNotOptimizeAway(sum);
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace parallel
+{
+    inline constexpr std::size_t size = 1 << 23;
+
+    // Sensor samples in [-100, 100]
+    inline auto make_data() -> std::vector<double>
+    {
+        nb::Rng gen{79};
+        std::vector<double> data(size);
+        for (auto & x : data)
+            x = gen.uniform01() * 200.0 - 100.0;
+        return data;
+    }
+
+    // Same data with one failing sample at 10% of the range, checks must stop early
+    inline auto make_failing_data(std::vector<double> data) -> std::vector<double>
+    {
+        data[data.size() / 10] = 1000.0;
+        return data;
+    }
+
+    constexpr auto in_bounds = ct::and_<ct::ge<-100.0>, ct::le<100.0>>;
+}
+
+namespace manual::parallel
+{
+    inline void run(std::vector<double> const & data)
+    {
+        bool const valid = std::ranges::all_of(data, [](double x) { return x >= -100.0 && x <= 100.0; });
+        nb::doNotOptimizeAway(valid);
+    }
+}
+
+namespace constrained::parallel
+{
+    // Calls combinator directly, so only the check is measured and data is not copied
+    template <auto Policy>
+    void run(std::vector<double> const & data)
+    {
+        bool const valid = ct::all_of<::parallel::in_bounds, Policy>(data);
+        nb::doNotOptimizeAway(valid);
+    }
+}
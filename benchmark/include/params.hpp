@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace params
+{
+    inline constexpr std::size_t size = 4096;
+
+    // Runtime value read by nullary callable parameter
+    inline int limit = 500;
+
+    inline auto make_ints() -> std::vector<int>
+    {
+        nb::Rng gen{31};
+        std::vector<int> data(size);
+        for (auto & x : data)
+            x = static_cast<int>(gen.bounded(1000));
+        return data;
+    }
+
+    inline auto make_strings() -> std::vector<std::string>
+    {
+        nb::Rng gen{37};
+        std::vector<std::string> data(size);
+        for (auto & s : data)
+            s.assign(gen.bounded(40) + 1, 'x');
+        return data;
+    }
+
+    template <typename T>
+    struct traits
+    {
+        using value_type = T;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = {};
+    };
+
+    template <typename T, auto... Constraints>
+    using constrained_t = ct::basic_constrained_type<T, traits<T>, ct::configuration_point{}, Constraints...>;
+
+    // Simple value
+    using value_t = constrained_t<int, ct::lt<500>>;
+    // Runtime value behind nullary callable
+    using runtime_t = constrained_t<int, ct::lt<[]{ return limit; }>>;
+    // Combinator value
+    using combinator_t = constrained_t<int, ct::lt<ct::val<500>>>;
+    // Object-callable value
+    using callable_t = constrained_t<int, ct::lt<[](int x) { return x * 2; }, 1000>>;
+    // Member pointer
+    using member_pointer_t = constrained_t<std::string, ct::lt<&std::string::length, std::size_t{20}>>;
+}
+
+namespace manual::params
+{
+    template <typename T, typename Predicate>
+    void run(std::vector<T> const & data, Predicate predicate)
+    {
+        std::size_t valid = 0;
+        for (auto const & x : data)
+        {
+            // Copy like constrained type does
+            T const value{x};
+            valid += predicate(value);
+        }
+        nb::doNotOptimizeAway(valid);
+    }
+}
+
+namespace constrained::params
+{
+    template <typename C>
+    void run(std::vector<typename C::value_type> const & data)
+    {
+        std::size_t valid = 0;
+        for (auto const & x : data)
+        {
+            C const c{x};
+            valid += static_cast<bool>(c);
+        }
+        nb::doNotOptimizeAway(valid);
+    }
+}
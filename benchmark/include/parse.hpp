@@ -0,0 +1,157 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace parse
+{
+    inline constexpr std::size_t count = 1 << 16;
+
+    using port_t = ct::constrained_type<int, ct::in_range<1, 65535>>;
+
+    /*
+     * CSV of ports, 16 values per line
+     * Valid data has only valid ports, in mixed data about a third of tokens is out of range
+     */
+    inline auto make_data(std::uint32_t max = 65535) -> std::string
+    {
+        nb::Rng gen{101};
+        std::string data;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            data += std::to_string(gen.bounded(max) + 1);
+            data += (i % 16 == 15) ? '\n' : ',';
+        }
+        return data;
+    }
+
+    inline auto make_mixed_data() -> std::string
+    { return make_data(99999); }
+
+    // Calls f for every token, invalid tokens are skipped by callers
+    template <typename F>
+    void for_each_token(std::string_view data, F && f)
+    {
+        std::size_t begin = 0;
+        while (begin < data.size())
+        {
+            auto const end = std::min(data.find_first_of(",\n", begin), data.size());
+            f(data.substr(begin, end - begin));
+            begin = end + 1;
+        }
+    }
+}
+
+namespace manual::parse
+{
+    // from_chars and range check of raw int
+    inline void run(std::string const & data, std::vector<int> & out)
+    {
+        out.clear();
+        auto p = data.data();
+        auto const last = p + data.size();
+        while (p != last)
+        {
+            int value = 0;
+            auto const [ptr, ec] = std::from_chars(p, last, value);
+            if (ec != std::errc{} or value < 1 or value > 65535)
+                break;
+            out.push_back(value);
+            p = ptr == last ? ptr : ptr + 1;
+        }
+        nb::doNotOptimizeAway(out.data());
+    }
+
+    inline void run_mixed(std::string const & data, std::vector<int> & out)
+    {
+        out.clear();
+        ::parse::for_each_token(data, [&out](std::string_view token) {
+            int value = 0;
+            auto const [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+            if (ec == std::errc{} and ptr == token.data() + token.size() and value >= 1 and value <= 65535)
+                out.push_back(value);
+        });
+        nb::doNotOptimizeAway(out.data());
+    }
+}
+
+namespace constrained::construct::parse
+{
+    // from_chars into int, then constructor checks constraints and throws std::logic_error
+    inline void run(std::string const & data, std::vector<::parse::port_t> & out)
+    {
+        out.clear();
+        auto p = data.data();
+        auto const last = p + data.size();
+        while (p != last)
+        {
+            int value = 0;
+            auto const [ptr, ec] = std::from_chars(p, last, value);
+            if (ec != std::errc{})
+                break;
+            try
+            {
+                out.push_back(::parse::port_t{value});
+            }
+            catch (std::logic_error const &)
+            {
+                break;
+            }
+            p = ptr == last ? ptr : ptr + 1;
+        }
+        nb::doNotOptimizeAway(out.data());
+    }
+
+    inline void run_mixed(std::string const & data, std::vector<::parse::port_t> & out)
+    {
+        out.clear();
+        ::parse::for_each_token(data, [&out](std::string_view token) {
+            int value = 0;
+            auto const [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+            if (ec != std::errc{} or ptr != token.data() + token.size())
+                return;
+            try
+            {
+                out.push_back(::parse::port_t{value});
+            }
+            catch (std::logic_error const &)
+            {
+            }
+        });
+        nb::doNotOptimizeAway(out.data());
+    }
+}
+
+namespace constrained::parse
+{
+    // Digits are limited by the interval, so in_range is not checked after conversion
+    inline void run(std::string const & data, std::vector<::parse::port_t> & out)
+    {
+        out.clear();
+        auto const result = ct::parse_many<::parse::port_t>(data, std::back_inserter(out));
+        nb::doNotOptimizeAway(result.count);
+        nb::doNotOptimizeAway(out.data());
+    }
+
+    // Out-of-range tokens are rejected by digit count or by a single comparison
+    inline void run_mixed(std::string const & data, std::vector<::parse::port_t> & out)
+    {
+        out.clear();
+        ::parse::for_each_token(data, [&out](std::string_view token) {
+            if (auto value = ct::parse<::parse::port_t>(token))
+                out.push_back(*value);
+        });
+        nb::doNotOptimizeAway(out.data());
+    }
+}
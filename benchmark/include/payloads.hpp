@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace payloads
+{
+    inline constexpr std::size_t strings = 1024;
+    inline constexpr std::size_t vectors = 256;
+
+    inline auto make_strings() -> std::vector<std::string>
+    {
+        nb::Rng gen{41};
+        std::vector<std::string> data(strings);
+        for (auto & s : data)
+        {
+            auto const length = 1 + gen.bounded(48);
+            for (std::size_t i = 0; i < length; ++i)
+                s += static_cast<char>('a' + gen.bounded(26));
+        }
+        return data;
+    }
+
+    inline auto make_vectors() -> std::vector<std::vector<int>>
+    {
+        nb::Rng gen{43};
+        std::vector<std::vector<int>> data(vectors);
+        for (auto & v : data)
+        {
+            v.resize(1 + gen.bounded(256));
+            for (auto & x : v)
+                x = static_cast<int>(gen.bounded(1000));
+            std::sort(v.begin(), v.end());
+        }
+        return data;
+    }
+
+    template <typename T>
+    struct traits
+    {
+        using value_type = T;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = {};
+    };
+
+    inline auto is_identifier(std::string const & s) -> bool
+    {
+        return std::all_of(s.begin(), s.end(), [](char c) {
+            return (c >= 'a' and c <= 'z') or (c >= '0' and c <= '9') or c == '_';
+        });
+    }
+
+    inline auto is_sorted(std::vector<int> const & v) -> bool
+    {
+        return std::is_sorted(v.begin(), v.end());
+    }
+
+    using identifier_t = ct::basic_constrained_type<
+        std::string, traits<std::string>, ct::configuration_point{},
+        ct::gt<&std::string::size, std::size_t{0}>,
+        ct::lt<&std::string::size, std::size_t{64}>,
+        [](std::string const & s) { return is_identifier(s); }
+    >;
+
+    using sorted_t = ct::basic_constrained_type<
+        std::vector<int>, traits<std::vector<int>>, ct::configuration_point{},
+        ct::gt<&std::vector<int>::size, std::size_t{0}>,
+        ct::le<&std::vector<int>::size, std::size_t{1024}>,
+        [](std::vector<int> const & v) { return is_sorted(v); }
+    >;
+}
+
+namespace manual::payloads
+{
+    inline auto identifier(std::string s) -> std::string
+    {
+        if (s.empty() or s.size() >= 64 or not ::payloads::is_identifier(s))
+            s.clear();
+        return s;
+    }
+
+    inline auto sorted(std::vector<int> v) -> std::vector<int>
+    {
+        if (v.empty() or v.size() > 1024 or not ::payloads::is_sorted(v))
+            v.clear();
+        return v;
+    }
+
+    inline void run_strings(std::vector<std::string> const & data)
+    {
+        std::size_t size = 0;
+        for (auto const & s : data)
+            size += identifier(s).size();
+        nb::doNotOptimizeAway(size);
+    }
+
+    inline void run_string_views(std::vector<std::string> const & data)
+    {
+        std::size_t size = 0;
+        for (auto const & s : data)
+            size += identifier(std::string{std::string_view{s}}).size();
+        nb::doNotOptimizeAway(size);
+    }
+
+    inline void run_vectors(std::vector<std::vector<int>> const & data)
+    {
+        std::size_t size = 0;
+        for (auto const & v : data)
+            size += sorted(v).size();
+        nb::doNotOptimizeAway(size);
+    }
+}
+
+namespace constrained::payloads
+{
+    inline void run_strings(std::vector<std::string> const & data)
+    {
+        std::size_t size = 0;
+        for (auto const & s : data)
+            size += ::payloads::identifier_t{s}->size();
+        nb::doNotOptimizeAway(size);
+    }
+
+    inline void run_string_views(std::vector<std::string> const & data)
+    {
+        std::size_t size = 0;
+        for (auto const & s : data)
+            size += ::payloads::identifier_t{std::string_view{s}}->size();
+        nb::doNotOptimizeAway(size);
+    }
+
+    inline void run_vectors(std::vector<std::vector<int>> const & data)
+    {
+        std::size_t size = 0;
+        for (auto const & v : data)
+            size += ::payloads::sorted_t{v}->size();
+        nb::doNotOptimizeAway(size);
+    }
+}
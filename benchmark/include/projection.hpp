@@ -0,0 +1,96 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace projection
+{
+    inline constexpr std::size_t count = 1 << 14;
+
+    // Service records like "name=svc-42;host=10.0.0.42;port=8081;weight=3", port is the last but one field
+    inline auto make_data() -> std::vector<std::string>
+    {
+        nb::Rng gen{103};
+        std::vector<std::string> data;
+        data.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            auto const id = std::to_string(gen.bounded(1000));
+            data.push_back(
+                "name=svc-" + id + ";host=10.0.0." + std::to_string(gen.bounded(256))
+                + ";port=" + std::to_string(gen.bounded(65000) + 1) + ";weight=" + std::to_string(gen.bounded(10))
+            );
+        }
+        return data;
+    }
+
+    // Costly projection: finds the field and converts it
+    inline constexpr auto parse_port = [](std::string_view record) noexcept -> int {
+        auto const begin = record.find("port=");
+        if (begin == std::string_view::npos)
+            return 0;
+        auto const digits = record.substr(begin + 5);
+        int port = 0;
+        std::from_chars(digits.data(), digits.data() + digits.size(), port);
+        return port;
+    };
+
+    // The same projection with a distinct identity per constraint, so its results can't be shared
+    template <int>
+    inline constexpr auto parse_port_copy = [](std::string_view record) noexcept -> int {
+        return parse_port(record);
+    };
+
+    using repeated_t = ct::constrained_type<std::string_view,
+        ct::ge<parse_port_copy<0>, 1>,
+        ct::le<parse_port_copy<1>, 65535>,
+        ct::neq<parse_port_copy<2>, 22>
+    >;
+
+    // Equal projections are detected and evaluated once
+    using shared_t = ct::constrained_type<std::string_view,
+        ct::ge<parse_port, 1>,
+        ct::le<parse_port, 65535>,
+        ct::neq<parse_port, 22>
+    >;
+
+    using proj_t = ct::constrained_type<std::string_view,
+        ct::proj<parse_port, ct::ge<1>, ct::le<65535>, ct::neq<22>>
+    >;
+}
+
+namespace manual::projection
+{
+    inline void run(std::vector<std::string> const & data, std::vector<std::string_view> & out)
+    {
+        out.clear();
+        for (auto const & record : data)
+        {
+            auto const port = ::projection::parse_port(record);
+            if (port >= 1 and port <= 65535 and port != 22)
+                out.emplace_back(record);
+        }
+        nb::doNotOptimizeAway(out.data());
+    }
+}
+
+namespace constrained::projection
+{
+    template <typename Constrained>
+    inline void run(std::vector<std::string> const & data, std::vector<Constrained> & out)
+    {
+        out.clear();
+        for (auto const & record : data)
+            if (auto value = Constrained::try_make(record))
+                out.push_back(*value);
+        nb::doNotOptimizeAway(out.data());
+    }
+}
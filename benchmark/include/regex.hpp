@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstddef>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace regex
+{
+    inline constexpr std::size_t size = 1024;
+
+    // Every 16th value does not match
+    inline auto make_identifiers() -> std::vector<std::string>
+    {
+        static constexpr std::string_view alphabet = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_";
+        nb::Rng gen{71};
+        std::vector<std::string> data(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            auto & s = data[i];
+            s.push_back(i % 16 == 0 ? '1' : 'x');
+            for (std::size_t n = 4 + gen.bounded(28); n > 0; --n)
+                s.push_back(alphabet[gen.bounded(alphabet.size())]);
+        }
+        return data;
+    }
+
+    inline auto make_emails() -> std::vector<std::string>
+    {
+        static constexpr std::string_view alphabet = "abcdefghijklmnopqrstuvwxyz0123456789._";
+        nb::Rng gen{73};
+        auto const word = [&gen](std::size_t length) {
+            std::string s;
+            for (; length > 0; --length)
+                s.push_back(alphabet[gen.bounded(alphabet.size())]);
+            return s;
+        };
+
+        std::vector<std::string> data(size);
+        for (std::size_t i = 0; i < size; ++i)
+            data[i] = word(4 + gen.bounded(12)) + (i % 16 == 0 ? "#" : "@") + word(4 + gen.bounded(8)) + ".com";
+        return data;
+    }
+
+    inline constexpr ct::fixed_string identifier = "[A-Za-z_][A-Za-z0-9_]*";
+    inline constexpr ct::fixed_string email = "[a-z0-9._%+-]+@[a-z0-9.-]+\\.[a-z]{2,}";
+
+    struct traits
+    {
+        using value_type = std::string_view;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = {};
+    };
+
+    template <ct::fixed_string Pattern>
+    using matches_t = ct::basic_constrained_type<std::string_view, traits, ct::configuration_point{}, ct::matches<Pattern>>;
+}
+
+namespace manual::regex
+{
+    inline auto is_identifier(std::string_view s) -> bool
+    {
+        auto const head = [](char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'; };
+        auto const tail = [&head](char c) { return head(c) || (c >= '0' && c <= '9'); };
+        if (s.empty() || !head(s[0]))
+            return false;
+        for (std::size_t i = 1; i < s.size(); ++i)
+        {
+            if (!tail(s[i]))
+                return false;
+        }
+        return true;
+    }
+
+    inline auto is_email(std::string_view s) -> bool
+    {
+        auto const local = [](char c) {
+            return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '.' || c == '_' || c == '%' || c == '+' || c == '-';
+        };
+        auto const domain = [](char c) { return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '.' || c == '-'; };
+
+        auto const at = s.find('@');
+        if (at == std::string_view::npos || at == 0)
+            return false;
+        for (std::size_t i = 0; i < at; ++i)
+        {
+            if (!local(s[i]))
+                return false;
+        }
+
+        // Domain part must end with '.' followed by at least two letters, the last such '.' is used
+        auto const rest = s.substr(at + 1);
+        auto const dot = rest.rfind('.');
+        if (dot == std::string_view::npos || dot == 0 || rest.size() - dot - 1 < 2)
+            return false;
+        for (std::size_t i = 0; i < dot; ++i)
+        {
+            if (!domain(rest[i]))
+                return false;
+        }
+        for (std::size_t i = dot + 1; i < rest.size(); ++i)
+        {
+            if (rest[i] < 'a' || rest[i] > 'z')
+                return false;
+        }
+        return true;
+    }
+
+    template <typename Predicate>
+    void run(std::vector<std::string> const & data, Predicate predicate)
+    {
+        std::size_t matched = 0;
+        for (auto const & s : data)
+            matched += predicate(s);
+        nb::doNotOptimizeAway(matched);
+    }
+
+    inline void run_std_regex(std::vector<std::string> const & data, std::regex const & re)
+    {
+        std::size_t matched = 0;
+        for (auto const & s : data)
+            matched += std::regex_match(s, re);
+        nb::doNotOptimizeAway(matched);
+    }
+}
+
+namespace constrained::regex
+{
+    template <typename C>
+    void run(std::vector<std::string> const & data)
+    {
+        std::size_t matched = 0;
+        for (auto const & s : data)
+        {
+            C const c{std::string_view{s}};
+            matched += static_cast<bool>(c);
+        }
+        nb::doNotOptimizeAway(matched);
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <combinators.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace sets
+{
+    using combinators::constrained_t;
+
+    template <int Lo, int Hi>
+    using and_range_t = constrained_t<ct::and_<ct::ge<Lo>, ct::le<Hi>>>;
+
+    template <int Lo, int Hi>
+    using in_range_t = constrained_t<ct::in_range<Lo, Hi>>;
+
+    template <int... Values>
+    using chain_t = constrained_t<ct::or_<ct::eq<Values>...>>;
+
+    template <int... Values>
+    using one_of_t = constrained_t<ct::one_of<Values...>>;
+
+    // Set<Start, Start + Step, ..., Start + (N - 1) * Step>
+    template <template <int...> typename Set, int Start, int Step, std::size_t... I>
+    auto progression(std::index_sequence<I...>) -> Set<(Start + Step * static_cast<int>(I))...>;
+
+    template <template <int...> typename Set, int Start, int Step, std::size_t N>
+    using progression_t = decltype(progression<Set, Start, Step>(std::make_index_sequence<N>{}));
+
+    // Bitmask strategy, every value is within 64 of the smallest one
+    template <template <int...> typename Set>
+    using dense_t = Set<0, 1, 2, 3, 5, 8, 13, 21, 34, 55>;
+
+    // Sorted table strategy
+    template <template <int...> typename Set>
+    using medium_t = progression_t<Set, -900, 73, 24>;
+
+    // Perfect hash strategy
+    template <template <int...> typename Set>
+    using large_t = progression_t<Set, -900, 7, 256>;
+}
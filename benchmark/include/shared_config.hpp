@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace shared_config
+{
+    // Operations per thread, every 16th of them is an update
+    inline constexpr std::size_t ops = 1 << 16;
+    inline constexpr std::size_t update_rate = 16;
+
+    using limit_t = ct::constrained_type<int, ct::in_range<1, 1000>>;
+
+    inline auto next_limit(int x) -> int
+    { return x % 1000 + 1; }
+
+    template <typename Worker>
+    void run_threads(unsigned threads, Worker worker)
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(threads);
+        for (unsigned i = 0; i < threads; ++i)
+            workers.emplace_back(worker);
+    }
+}
+
+namespace manual::shared_config
+{
+    // Mutex around constrained value, updates construct and check new value under the lock
+    struct config
+    {
+        mutable std::mutex mutex;
+        ::shared_config::limit_t limit{1};
+    };
+
+    inline void run(config & shared, unsigned threads)
+    {
+        ::shared_config::run_threads(threads, [&shared]{
+            long long sum = 0;
+            for (std::size_t i = 0; i < ::shared_config::ops; ++i)
+            {
+                std::lock_guard lock{shared.mutex};
+                if (i % ::shared_config::update_rate == 0)
+                    shared.limit = ::shared_config::limit_t{::shared_config::next_limit(*shared.limit)};
+                else
+                    sum += *shared.limit;
+            }
+            nb::doNotOptimizeAway(sum);
+        });
+    }
+}
+
+namespace constrained::shared_config
+{
+    // Loads are plain atomic loads, updates check candidate before CAS
+    inline void run(ct::atomic<::shared_config::limit_t> & shared, unsigned threads)
+    {
+        ::shared_config::run_threads(threads, [&shared]{
+            long long sum = 0;
+            for (std::size_t i = 0; i < ::shared_config::ops; ++i)
+            {
+                if (i % ::shared_config::update_rate == 0)
+                {
+                    auto const previous = shared.fetch_update([](::shared_config::limit_t const & x) {
+                        return ::shared_config::next_limit(*x);
+                    }, std::memory_order_acq_rel);
+                    nb::doNotOptimizeAway(previous);
+                }
+                else
+                    sum += *shared.load(std::memory_order_acquire);
+            }
+            nb::doNotOptimizeAway(sum);
+        });
+    }
+}
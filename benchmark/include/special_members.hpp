@@ -0,0 +1,97 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace special_members
+{
+    inline constexpr std::size_t size = 1024;
+
+    template <typename T>
+    auto make_value(nb::Rng & gen) -> T
+    {
+        if constexpr (std::same_as<T, int>)
+            return static_cast<int>(gen.bounded(1000)) + 1;
+        else if constexpr (std::same_as<T, std::string>)
+            return std::string(1 + gen.bounded(64), 'x');
+        else
+            return std::vector<int>(1 + gen.bounded(64), 1);
+    }
+
+    template <typename T>
+    auto make_data() -> std::vector<T>
+    {
+        nb::Rng gen{47};
+        std::vector<T> data;
+        data.reserve(size);
+        for (std::size_t i = 0; i < size; ++i)
+            data.push_back(make_value<T>(gen));
+        return data;
+    }
+
+    template <typename T>
+    struct traits
+    {
+        using value_type = T;
+        static constexpr bool is_nullable = true;
+        static constexpr value_type null = {};
+    };
+
+    constexpr auto not_empty = [](auto const & x) { return x != std::remove_cvref_t<decltype(x)>{}; };
+
+    template <typename T>
+    using constrained_t = ct::basic_constrained_type<T, traits<T>, ct::configuration_point{}, not_empty>;
+
+    template <typename C>
+    auto make_constrained_data() -> std::vector<C>
+    {
+        std::vector<C> data;
+        data.reserve(size);
+        for (auto & x : make_data<typename C::value_type>())
+            data.emplace_back(std::move(x));
+        return data;
+    }
+
+    /*
+     * Special members are the same for manual and constrained values, V is either T or constrained_t<T>
+     * Constrained special members must not check anything
+     */
+    template <typename V>
+    void copy_construct(std::vector<V> const & data)
+    {
+        for (auto const & x : data)
+        {
+            V copy{x};
+            nb::doNotOptimizeAway(copy);
+        }
+    }
+
+    template <typename V>
+    void copy_assign(std::vector<V> const & data, std::vector<V> & target)
+    {
+        for (std::size_t i = 0; i < data.size(); ++i)
+            target[i] = data[i];
+        nb::doNotOptimizeAway(target);
+    }
+
+    // Move construction and move assignment back, so data stays valid
+    template <typename V>
+    void move_round_trip(std::vector<V> & data)
+    {
+        for (auto & x : data)
+        {
+            V moved{std::move(x)};
+            nb::doNotOptimizeAway(moved);
+            x = std::move(moved);
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace static_table
+{
+    inline constexpr std::size_t size = 4096;
+
+    using port_t = ct::constrained_type<int, ct::in_range<1, 65535>>;
+
+    // Routing table known at compile time
+    inline constexpr auto raw_table = []{
+        std::array<int, size> result{};
+        std::uint32_t x = 107;
+        for (auto & port : result)
+        {
+            x = x * 1103515245u + 12345u;
+            port = static_cast<int>(x % 65535) + 1;
+        }
+        return result;
+    }();
+
+    inline constexpr auto table = ct::make_static_table<port_t, raw_table>();
+}
+
+namespace manual::static_table
+{
+    // Raw table is copied, nothing is checked
+    inline void run(std::vector<int> & out)
+    {
+        out.assign(::static_table::raw_table.begin(), ::static_table::raw_table.end());
+        nb::doNotOptimizeAway(out.data());
+    }
+}
+
+namespace constrained::dynamic::static_table
+{
+    // Every entry is checked, like a table built during static initialization
+    inline void run(std::vector<::static_table::port_t> & out)
+    {
+        out.clear();
+        for (auto port : ::static_table::raw_table)
+            out.emplace_back(port);
+        nb::doNotOptimizeAway(out.data());
+    }
+}
+
+namespace constrained::static_table
+{
+    // Table was checked at compile time, so it is just copied
+    inline void run(std::vector<::static_table::port_t> & out)
+    {
+        out.assign(::static_table::table.begin(), ::static_table::table.end());
+        nb::doNotOptimizeAway(out.data());
+    }
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace strings
+{
+    inline constexpr std::size_t fields = 4096;
+
+    /*
+     * Fields of a network buffer, every field is a view into buffer
+     * Fields are identifiers of 8 to 128 characters, so every check passes
+     */
+    struct data
+    {
+        std::string buffer;
+        std::vector<std::string_view> fields;
+    };
+
+    inline auto make_data() -> data
+    {
+        static constexpr std::string_view alphabet = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_";
+
+        nb::Rng gen{67};
+        std::vector<std::size_t> lengths(fields);
+        for (auto & length : lengths)
+            length = 8 + gen.bounded(121);
+
+        data result;
+        for (auto length : lengths)
+        {
+            for (std::size_t i = 0; i < length; ++i)
+                result.buffer.push_back(alphabet[gen.bounded(alphabet.size())]);
+        }
+
+        std::size_t offset = 0;
+        for (auto length : lengths)
+        {
+            result.fields.push_back(std::string_view{result.buffer}.substr(offset, length));
+            offset += length;
+        }
+        return result;
+    }
+
+    // Straightforward scalar formulations over std::string
+    constexpr auto is_ascii = [](std::string const & s) {
+        return std::ranges::all_of(s, [](char c) { return static_cast<unsigned char>(c) < 0x80; });
+    };
+
+    constexpr auto is_identifier = [](std::string const & s) {
+        return std::ranges::all_of(s, [](char c) {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        });
+    };
+
+    constexpr auto has_no_control_chars = [](std::string const & s) {
+        return std::ranges::all_of(s, [](char c) { return static_cast<unsigned char>(c) >= 0x20 && c != 0x7F; });
+    };
+
+    constexpr auto is_utf8 = [](std::string const & s) {
+        for (std::size_t i = 0; i < s.size();)
+        {
+            auto const lead = static_cast<unsigned char>(s[i]);
+            std::size_t const length = lead < 0x80 ? 1 : lead < 0xC2 ? 0 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : lead < 0xF5 ? 4 : 0;
+            if (length == 0 || s.size() - i < length)
+                return false;
+            for (std::size_t k = 1; k < length; ++k)
+            {
+                if ((static_cast<unsigned char>(s[i + k]) & 0xC0) != 0x80)
+                    return false;
+            }
+            i += length;
+        }
+        return true;
+    };
+
+    constexpr auto length_in_range = [](std::string const & s) { return s.size() >= 1 && s.size() <= 256; };
+
+    using string_ascii_t = ct::constrained_type<std::string, is_ascii>;
+    using string_identifier_t = ct::constrained_type<std::string, length_in_range, is_identifier>;
+    using string_no_control_t = ct::constrained_type<std::string, has_no_control_chars>;
+    using string_utf8_t = ct::constrained_type<std::string, is_utf8>;
+
+    using view_ascii_t = ct::constrained_type<std::string_view, ct::ascii>;
+    using view_identifier_t = ct::constrained_type<std::string_view, ct::length_in<1, 256>, ct::charset<"a-zA-Z0-9_">>;
+    using view_no_control_t = ct::constrained_type<std::string_view, ct::no_control_chars>;
+    using view_utf8_t = ct::constrained_type<std::string_view, ct::utf8_valid>;
+
+    // Copies every field to std::string before the check
+    template <typename C>
+    void run_string(data const & d)
+    {
+        std::size_t total = 0;
+        for (auto field : d.fields)
+        {
+            C const c{std::string{field}};
+            total += c->size();
+        }
+        nb::doNotOptimizeAway(total);
+    }
+
+    // Checks fields in place
+    template <typename C>
+    void run_view(data const & d)
+    {
+        std::size_t total = 0;
+        for (auto field : d.fields)
+        {
+            C const c{field};
+            total += c->size();
+        }
+        nb::doNotOptimizeAway(total);
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <nanobench.h>
+
+namespace nb = ankerl::nanobench;
+
+/*
+ * Shared setup of regression suites
+ * Every case is run twice: "manual <case>" is hand-written baseline, "constrained <case>" uses library
+ * compare.py matches results by title and name
+ */
+namespace suite
+{
+    inline auto make_bench(std::string const & title) -> nb::Bench
+    {
+        auto bench = nb::Bench();
+        bench
+            .title(title)
+            .warmup(100)
+            .epochs(100)
+            .minEpochIterations(100);
+        return bench;
+    }
+
+    /*
+     * Writes results as nanobench JSON to file given as the first command line argument
+     * Without arguments only the table is printed
+     */
+    inline auto render_json(nb::Bench const & bench, int argc, char ** argv) -> int
+    {
+        if (argc < 2)
+            return 0;
+
+        std::ofstream out{argv[1]};
+        if (not out)
+        {
+            std::cerr << "Cannot open " << argv[1] << '\n';
+            return 1;
+        }
+        nb::render(nb::templates::json(), bench, out);
+        return 0;
+    }
+}
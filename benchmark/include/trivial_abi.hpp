@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+namespace nb = ankerl::nanobench;
+
+namespace trivial_abi
+{
+    template <typename T>
+    using non_null = ct::constrained_type<T*, ct::neq<nullptr>>;
+
+    using positive = ct::constrained_type<int, ct::gt<0>>;
+    using non_empty = ct::constrained_type<std::string, [](std::string const & s) { return not s.empty(); }>;
+
+    // Wrapped type must keep triviality of T
+    static_assert(std::is_trivially_copyable_v<non_null<int>>);
+    static_assert(std::is_trivially_copy_constructible_v<non_null<int>>);
+    static_assert(std::is_trivially_move_constructible_v<non_null<int>>);
+    static_assert(std::is_trivially_copy_assignable_v<non_null<int>>);
+    static_assert(std::is_trivially_move_assignable_v<non_null<int>>);
+    static_assert(std::is_trivially_destructible_v<non_null<int>>);
+    static_assert(std::is_trivially_copyable_v<positive>);
+    static_assert(sizeof(non_null<int>) == sizeof(int*));
+
+    // And keep non-triviality and exception specifications of non-trivial T
+    static_assert(not std::is_trivially_copyable_v<non_empty>);
+    static_assert(std::is_copy_constructible_v<non_empty>);
+    static_assert(std::is_nothrow_move_constructible_v<non_empty>);
+    static_assert(std::is_nothrow_move_assignable_v<non_empty>);
+    static_assert(not std::is_nothrow_copy_constructible_v<non_empty>);
+
+    // Copy and move are usable in constant expressions
+    static_assert([]{
+        positive x{42};
+        positive y = x;
+        positive z = std::move(y);
+        z = x;
+        return *z;
+    }() == 42);
+
+    inline constexpr std::size_t size = 1'000'000;
+}
+
+namespace manual::trivial_abi
+{
+    template <typename T>
+    [[gnu::noinline]] auto dereference(T *x) -> T
+    {
+        return *x;
+    }
+
+    template <typename T>
+    void run_by_value()
+    {
+        T x{};
+        nb::doNotOptimizeAway(dereference<T>(&x));
+    }
+
+    template <typename T>
+    void run_vector_growth()
+    {
+        T x{};
+        std::vector<T*> v;
+        for (std::size_t i = 0; i < ::trivial_abi::size; ++i)
+            v.push_back(&x);
+        nb::doNotOptimizeAway(v.data());
+    }
+}
+
+namespace constrained::trivial_abi
+{
+    using ::trivial_abi::non_null;
+
+    template <typename T>
+    [[gnu::noinline]] auto dereference(non_null<T> x) -> T
+    {
+        return *x;
+    }
+
+    template <typename T>
+    void run_by_value()
+    {
+        T x{};
+        nb::doNotOptimizeAway(dereference<T>(non_null<T>{&x}));
+    }
+
+    template <typename T>
+    void run_vector_growth()
+    {
+        T x{};
+        std::vector<non_null<T>> v;
+        for (std::size_t i = 0; i < ::trivial_abi::size; ++i)
+            v.push_back(non_null<T>{&x});
+        nb::doNotOptimizeAway(v.data());
+    }
+}
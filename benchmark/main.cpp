@@ -2,10 +2,19 @@
 #include <cstdint>
 #include <string>
 #include <cstdlib>
+#include <iostream>
 #include <nanobench.h>
 #include <constrained_type.hpp>
 
 #include <non_null.hpp>
+#include <bulk_validate.hpp>
+#include <branchless.hpp>
+#include <trivial_abi.hpp>
+#include <normalized_pack.hpp>
+#include <memoized.hpp>
+#include <lazy.hpp>
+#include <instrumentation.hpp>
+#include <adaptive.hpp>
 
 int main()
 {
@@ -20,6 +29,9 @@ int main()
         .run("constrained nullable non_null", []{
             constrained::nullable::non_null::run<int>();
         })
+        .run("constrained expected non_null", []{
+            constrained::expected::non_null::run<int>();
+        })
         .minEpochIterations(10'000)
         .run("manual throwing non_null", []{
             manual::throwing::non_null::run<int>();
@@ -27,4 +39,247 @@ int main()
         .run("constrained throwing non_null", []{
             constrained::throwing::non_null::run<int>();
         });
+
+    auto const ints = bulk_validate::make_data<int>();
+    auto const floats = bulk_validate::make_data<float>();
+
+    auto bench_bulk = nb::Bench();
+    bench_bulk
+        .warmup(3)
+        .epochs(10)
+        .minEpochIterations(5)
+        .batch(bulk_validate::size)
+        .unit("element")
+        .run("per-element construction int ge/lt", [&]{
+            constrained::per_element::bulk_validate::run<bulk_validate::range_t<int>>(ints);
+        })
+        .run("validate mask int ge/lt", [&]{
+            constrained::bulk::bulk_validate::run_mask<bulk_validate::range_t<int>>(ints);
+        })
+        .run("validate first int ge/lt", [&]{
+            constrained::bulk::bulk_validate::run_first<bulk_validate::range_t<int>>(ints);
+        })
+        .run("per-element construction float ge/lt", [&]{
+            constrained::per_element::bulk_validate::run<bulk_validate::range_t<float>>(floats);
+        })
+        .run("validate mask float ge/lt", [&]{
+            constrained::bulk::bulk_validate::run_mask<bulk_validate::range_t<float>>(floats);
+        })
+        .run("per-element construction int lambda", [&]{
+            constrained::per_element::bulk_validate::run<bulk_validate::lambda_t<int>>(ints);
+        })
+        .run("validate mask int lambda (scalar fallback)", [&]{
+            constrained::bulk::bulk_validate::run_mask<bulk_validate::lambda_t<int>>(ints);
+        });
+
+    auto partitioned = ints;
+    bench_bulk
+        .run("validate partition int ge/lt", [&]{
+            partitioned = ints;
+            constrained::bulk::bulk_validate::run_partition<bulk_validate::range_t<int>>(partitioned);
+        });
+
+    for (unsigned failure_percent : {1U, 10U, 50U})
+    {
+        auto const data = branchless::make_data(failure_percent);
+        auto const suffix = " (" + std::to_string(failure_percent) + "% failures)";
+
+        auto bench_branchless = nb::Bench();
+        bench_branchless
+            .warmup(100)
+            .epochs(100)
+            .minEpochIterations(100)
+            .batch(branchless::size)
+            .unit("value")
+            .run("manual range" + suffix, [&]{
+                manual::branchless::run(data);
+            })
+            .run("constrained short-circuit range" + suffix, [&]{
+                constrained::branchless::run<branchless::range_t<branchless::short_circuit>>(data);
+            })
+            .run("constrained branchless range" + suffix, [&]{
+                constrained::branchless::run<branchless::range_t<branchless::branchless_checks>>(data);
+            })
+            .run("constrained or_/and_" + suffix, [&]{
+                constrained::branchless::run<branchless::or_t>(data);
+            })
+            .run("constrained branchless_or/branchless_and" + suffix, [&]{
+                constrained::branchless::run<branchless::branchless_or_t>(data);
+            })
+            .run("constrained if_" + suffix, [&]{
+                constrained::branchless::run<branchless::if_t>(data);
+            })
+            .run("constrained branchless_if" + suffix, [&]{
+                constrained::branchless::run<branchless::branchless_if_t>(data);
+            });
+    }
+
+    auto bench_trivial_abi = nb::Bench();
+    bench_trivial_abi
+        .warmup(100)
+        .epochs(100)
+        .minEpochIterations(100'000)
+        .run("manual pass by value", []{
+            manual::trivial_abi::run_by_value<int>();
+        })
+        .run("constrained pass by value", []{
+            constrained::trivial_abi::run_by_value<int>();
+        })
+        .warmup(3)
+        .epochs(10)
+        .minEpochIterations(5)
+        .batch(trivial_abi::size)
+        .unit("push_back")
+        .run("manual vector growth", []{
+            manual::trivial_abi::run_vector_growth<int>();
+        })
+        .run("constrained vector growth", []{
+            constrained::trivial_abi::run_vector_growth<int>();
+        });
+
+    auto const normalized_data = normalized_pack::make_data();
+
+    auto bench_normalized = nb::Bench();
+    bench_normalized
+        .warmup(100)
+        .epochs(100)
+        .minEpochIterations(100)
+        .batch(normalized_pack::size)
+        .unit("value")
+        .run("manual minimal checks", [&]{
+            manual::normalized_pack::run(normalized_data);
+        })
+        .run("constrained redundant pack", [&]{
+            constrained::normalized_pack::run<normalized_pack::redundant_t>(normalized_data);
+        })
+        .run("constrained normalize_constraints pack", [&]{
+            constrained::normalized_pack::run<normalized_pack::normalized_t>(normalized_data);
+        })
+        .run("constrained normalize_constraints config", [&]{
+            constrained::normalized_pack::run<normalized_pack::normalized_config_t>(normalized_data);
+        });
+
+    auto bench_check_policy = nb::Bench();
+    bench_check_policy
+        .warmup(100)
+        .epochs(100)
+        .minEpochIterations(100'000)
+        .run("manual raw non_null", []{
+            manual::raw::non_null::run<int>();
+        })
+        .run("constrained always checked non_null", []{
+            constrained::always::non_null::run<int>();
+        })
+        .run("constrained sampled non_null", []{
+            constrained::sampled::non_null::run<int>();
+        })
+        .run("constrained trusted non_null", []{
+            constrained::trusted::non_null::run<int>();
+        });
+
+    auto const memoized_keys = memoized::make_keys();
+    for (double exponent : {0.8, 1.1, 1.4})
+    {
+        auto const data = memoized::make_data(memoized_keys, exponent);
+        auto const suffix = " (zipf s=" + std::to_string(exponent).substr(0, 3) + ")";
+
+        ct::memo_clear<ct::memoized<memoized::identifier, 1024>, std::string>();
+
+        auto bench_memoized = nb::Bench();
+        bench_memoized
+            .warmup(10)
+            .epochs(50)
+            .minEpochIterations(10)
+            .batch(memoized::size)
+            .unit("value")
+            .run("manual identifier check" + suffix, [&]{
+                manual::memoized::run(data);
+            })
+            .run("constrained identifier check" + suffix, [&]{
+                constrained::memoized::run<memoized::plain_t>(data);
+            })
+            .run("constrained memoized identifier check" + suffix, [&]{
+                constrained::memoized::run<memoized::memoized_t>(data);
+            });
+
+        auto const stats = ct::memo_stats<ct::memoized<memoized::identifier, 1024>, std::string>();
+        std::cout << "memoized" << suffix << ": " << stats.hits << " hits, " << stats.misses << " misses\n";
+    }
+
+    auto const lazy_data = lazy::make_data();
+    for (std::size_t touched : {std::size_t{1}, std::size_t{4}, std::size_t{16}, lazy::fields})
+    {
+        auto const suffix = " (" + std::to_string(touched) + " of " + std::to_string(lazy::fields) + " fields)";
+
+        auto bench_lazy = nb::Bench();
+        bench_lazy
+            .warmup(10)
+            .epochs(50)
+            .minEpochIterations(10)
+            .batch(lazy::requests)
+            .unit("request")
+            .run("manual checks on read" + suffix, [&]{
+                manual::lazy::run(lazy_data, touched);
+            })
+            .run("constrained eager checks" + suffix, [&]{
+                constrained::lazy::run<lazy::eager_t>(lazy_data, touched);
+            })
+            .run("constrained lazy checks" + suffix, [&]{
+                constrained::lazy::run<lazy::lazy_t>(lazy_data, touched);
+            });
+    }
+
+    auto bench_lazy_all = nb::Bench();
+    bench_lazy_all
+        .warmup(10)
+        .epochs(50)
+        .minEpochIterations(10)
+        .batch(lazy::requests)
+        .unit("request")
+        .run("constrained lazy validate_all", [&]{
+            constrained::lazy::run_validate_all<lazy::lazy_t>(lazy_data);
+        })
+        .run("constrained eager validate_all", [&]{
+            constrained::lazy::run_validate_all<lazy::eager_t>(lazy_data);
+        });
+
+    auto const instrumentation_data = instrumentation::make_data();
+
+    auto bench_instrumentation = nb::Bench();
+    bench_instrumentation
+        .warmup(100)
+        .epochs(100)
+        .minEpochIterations(100)
+        .batch(instrumentation::size)
+        .unit("value")
+        .run("constrained not instrumented", [&]{
+            constrained::instrumentation::run<instrumentation::plain_t>(instrumentation_data);
+        })
+        .run("constrained instrumented counters", [&]{
+            constrained::instrumentation::run<instrumentation::counted_t>(instrumentation_data);
+        })
+        .run("constrained instrumented counters and cycle sampler", [&]{
+            constrained::instrumentation::run<instrumentation::timed_t>(instrumentation_data);
+        });
+
+    ct::dump_instrumentation(std::cout);
+
+    auto const adaptive_data = adaptive::make_data();
+
+    auto bench_adaptive = nb::Bench();
+    bench_adaptive
+        .warmup(10)
+        .epochs(50)
+        .minEpochIterations(10)
+        .batch(adaptive::size)
+        .unit("value")
+        .run("manual declaration order (drifting input)", [&]{
+            manual::adaptive::run(adaptive_data);
+        })
+        .run("constrained declaration order (drifting input)", [&]{
+            constrained::adaptive::run<adaptive::ordered_t>(adaptive_data);
+        })
+        .run("constrained adaptive_and (drifting input)", [&]{
+            constrained::adaptive::run<adaptive::adaptive_t>(adaptive_data);
+        });
 }
@@ -0,0 +1,33 @@
+#include <string>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <bounded.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto const bounded_raw_data = bounded::make_raw_data();
+    auto const bounded_data = bounded::make_data(bounded_raw_data);
+
+    auto bench = suite::make_bench("bounded");
+    bench
+        .warmup(100)
+        .epochs(100)
+        .minEpochIterations(100)
+        .batch(bounded::size)
+        .unit("sample")
+        .run("manual bounded arithmetic", [&]{
+            manual::bounded::run(bounded_raw_data);
+        })
+        .run("constrained rewrap and recheck", [&]{
+            constrained::rewrap::bounded::run(bounded_data);
+        })
+        .run("constrained bounded arithmetic", [&]{
+            constrained::bounded::run(bounded_data);
+        });
+
+    return suite::render_json(bench, argc, argv);
+}
@@ -0,0 +1,37 @@
+#include <string>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <check_traits.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto bench = suite::make_bench("check traits");
+    bench
+        .batch(check_traits::size)
+        .unit("value");
+
+    for (unsigned failure_permille : {0U, 10U, 100U})
+    {
+        auto const data = check_traits::make_data(failure_permille);
+        auto const suffix = " (" + std::to_string(failure_permille / 10.0).substr(0, 3) + "% failures)";
+
+        bench
+            .run("manual nullable" + suffix, [&]{
+                manual::check_traits::run_nullable(data);
+            })
+            .run("constrained nullable" + suffix, [&]{
+                constrained::check_traits::run_nullable(data);
+            })
+            .run("manual throwing" + suffix, [&]{
+                manual::check_traits::run_throwing(data);
+            })
+            .run("constrained throwing" + suffix, [&]{
+                constrained::check_traits::run_throwing(data);
+            });
+    }
+
+    return suite::render_json(bench, argc, argv);
+}
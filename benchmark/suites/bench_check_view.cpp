@@ -0,0 +1,39 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <check_view.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto const check_view_data = check_view::make_data();
+    std::vector<std::string> raw_usernames;
+    std::vector<check_view::username_t<false>> usernames;
+    std::vector<check_view::username_t<true>> viewed_usernames;
+    raw_usernames.reserve(check_view::count);
+    usernames.reserve(check_view::count);
+    viewed_usernames.reserve(check_view::count);
+
+    auto bench = suite::make_bench("check view");
+    bench
+        .warmup(10)
+        .epochs(50)
+        .minEpochIterations(10)
+        .batch(check_view::count)
+        .unit("name")
+        .run("manual check view", [&]{
+            manual::check_view::run(check_view_data, raw_usernames);
+        })
+        .run("constrained check after copy", [&]{
+            constrained::check_view::run<false>(check_view_data, usernames);
+        })
+        .run("constrained check view", [&]{
+            constrained::check_view::run<true>(check_view_data, viewed_usernames);
+        });
+
+    return suite::render_json(bench, argc, argv);
+}
@@ -0,0 +1,65 @@
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <combinators.hpp>
+
+int main(int argc, char ** argv)
+{
+    using namespace ct;
+    using combinators::add_case;
+    using combinators::constrained_t;
+
+    auto const data = combinators::make_data();
+
+    auto bench = suite::make_bench("combinators");
+    bench
+        .batch(combinators::size)
+        .unit("value");
+
+    add_case<constrained_t<eq<7>>>(bench, "eq", data, [](int x) { return x == 7; });
+    add_case<constrained_t<neq<0>>>(bench, "neq", data, [](int x) { return x != 0; });
+    add_case<constrained_t<gt<0>>>(bench, "gt", data, [](int x) { return x > 0; });
+    add_case<constrained_t<ge<0>>>(bench, "ge", data, [](int x) { return x >= 0; });
+    add_case<constrained_t<lt<0>>>(bench, "lt", data, [](int x) { return x < 0; });
+    add_case<constrained_t<le<0>>>(bench, "le", data, [](int x) { return x <= 0; });
+    add_case<constrained_t<not_<eq<0>>>>(bench, "not_", data, [](int x) { return !(x == 0); });
+
+    add_case<constrained_t<and_<ge<-500>, lt<500>>>>(bench, "and_", data, [](int x) {
+        return x >= -500 && x < 500;
+    });
+    add_case<constrained_t<or_<lt<-500>, gt<500>>>>(bench, "or_", data, [](int x) {
+        return x < -500 || x > 500;
+    });
+    add_case<constrained_t<if_<gt<0>, lt<500>, gt<-500>>>>(bench, "if_", data, [](int x) {
+        return x > 0 ? x < 500 : x > -500;
+    });
+
+    add_case<constrained_t<branchless_and<ge<-500>, lt<500>>>>(bench, "branchless_and", data, [](int x) {
+        return (x >= -500) & (x < 500);
+    });
+    add_case<constrained_t<branchless_or<lt<-500>, gt<500>>>>(bench, "branchless_or", data, [](int x) {
+        return (x < -500) | (x > 500);
+    });
+    add_case<constrained_t<branchless_if<gt<0>, lt<500>, gt<-500>>>>(bench, "branchless_if", data, [](int x) {
+        return ((x > 0) & (x < 500)) | (!(x > 0) & (x > -500));
+    });
+
+    add_case<constrained_t<and_<or_<lt<-900>, gt<-100>>, if_<gt<0>, lt<500>, not_<eq<-50>>>, neq<7>>>>(
+        bench, "nested and_/or_/if_/not_", data, [](int x) {
+            return (x < -900 || x > -100) && (x > 0 ? x < 500 : !(x == -50)) && x != 7;
+        }
+    );
+    add_case<constrained_t<in_range<-500, 500>>>(bench, "in_range", data, [](int x) {
+        return x >= -500 && x <= 500;
+    });
+    add_case<constrained_t<one_of<0, 1, 2, 3, 5, 8, 13, 21, 34, 55>>>(bench, "one_of", data, [](int x) {
+        return x == 0 || x == 1 || x == 2 || x == 3 || x == 5 || x == 8 || x == 13 || x == 21 || x == 34 || x == 55;
+    });
+
+    add_case<constrained_t<gt<-900>, lt<900>, neq<0>, neq<1>>>(bench, "constraint pack", data, [](int x) {
+        return x > -900 && x < 900 && x != 0 && x != 1;
+    });
+
+    return suite::render_json(bench, argc, argv);
+}
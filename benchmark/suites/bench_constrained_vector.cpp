@@ -0,0 +1,35 @@
+#include <string>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <constrained_vector.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto const vector_data = constrained_vector::make_data();
+
+    auto bench = suite::make_bench("constrained vector");
+    bench
+        .warmup(10)
+        .epochs(50)
+        .minEpochIterations(10)
+        .batch(constrained_vector::size)
+        .unit("element")
+        .run("manual push_back", [&]{
+            manual::constrained_vector::run_push_back(vector_data);
+        })
+        .run("constrained push_back (rewrapped constrained_type<std::vector>)", [&]{
+            constrained::constrained_vector::run_rewrap(vector_data);
+        })
+        .run("constrained push_back", [&]{
+            constrained::constrained_vector::run_push_back(vector_data);
+        })
+        .run("constrained append_range", [&]{
+            constrained::constrained_vector::run_append_range(vector_data);
+        });
+
+    return suite::render_json(bench, argc, argv);
+}
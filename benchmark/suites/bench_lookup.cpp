@@ -0,0 +1,39 @@
+#include <string>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <lookup.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto const lookup_data = lookup::make_data();
+    auto const wrapping_id_map = lookup::make_id_map<lookup::wrapping_map<lookup::id_t>>(lookup_data);
+    auto const transparent_id_map = lookup::make_id_map<lookup::transparent_map<lookup::id_t>>(lookup_data);
+    auto const wrapping_name_map = lookup::make_name_map<lookup::wrapping_map<lookup::name_t>>(lookup_data);
+    auto const transparent_name_map = lookup::make_name_map<lookup::transparent_map<lookup::name_t>>(lookup_data);
+
+    auto bench = suite::make_bench("lookup");
+    bench
+        .warmup(10)
+        .epochs(50)
+        .minEpochIterations(10)
+        .batch(lookup::queries)
+        .unit("lookup")
+        .run("constrained id wrap-then-find", [&]{
+            constrained::wrap::lookup::run_ids(wrapping_id_map, lookup_data.id_queries);
+        })
+        .run("constrained id transparent find", [&]{
+            constrained::lookup::run(transparent_id_map, lookup_data.id_queries);
+        })
+        .run("constrained name wrap-then-find", [&]{
+            constrained::wrap::lookup::run_names(wrapping_name_map, lookup_data.name_queries);
+        })
+        .run("constrained name transparent find (string_view)", [&]{
+            constrained::lookup::run(transparent_name_map, lookup_data.name_queries);
+        });
+
+    return suite::render_json(bench, argc, argv);
+}
@@ -0,0 +1,34 @@
+#include <optional>
+#include <string>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <niche_optional.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto const niche_data = niche_optional::make_data();
+    auto const std_optional_cache = niche_optional::make_cache<std::optional<niche_optional::id_t>>(niche_data);
+    auto const niche_optional_cache = niche_optional::make_cache<ct::optional<niche_optional::id_t>>(niche_data);
+
+    auto bench = suite::make_bench("niche optional");
+    bench
+        .warmup(3)
+        .epochs(20)
+        .minEpochIterations(1)
+        .batch(niche_optional::size)
+        .unit("id")
+        .run("manual sentinel int (" + std::to_string(sizeof(int)) + " bytes)", [&]{
+            manual::niche_optional::run(niche_data);
+        })
+        .run("std::optional<constrained> (" + std::to_string(sizeof(std::optional<niche_optional::id_t>)) + " bytes)", [&]{
+            constrained::niche_optional::run(std_optional_cache);
+        })
+        .run("ct::optional<constrained> (" + std::to_string(sizeof(ct::optional<niche_optional::id_t>)) + " bytes)", [&]{
+            constrained::niche_optional::run(niche_optional_cache);
+        });
+
+    return suite::render_json(bench, argc, argv);
+}
@@ -0,0 +1,53 @@
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <parallel.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto const parallel_data = parallel::make_data();
+    auto const parallel_failing_data = parallel::make_failing_data(parallel_data);
+
+    auto bench = suite::make_bench("parallel");
+    bench
+        .warmup(2)
+        .epochs(20)
+        .minEpochIterations(1)
+        .batch(parallel::size)
+        .unit("sample")
+        .run("manual all_of", [&]{
+            manual::parallel::run(parallel_data);
+        })
+        .run("constrained all_of seq", [&]{
+            constrained::parallel::run<ct::seq>(parallel_data);
+        });
+
+    // 1, 2, 4, ... threads and all hardware threads
+    auto const max_threads = std::max(std::thread::hardware_concurrency(), 1U);
+    std::vector<unsigned> thread_counts;
+    for (unsigned threads = 1; threads < max_threads; threads *= 2)
+        thread_counts.push_back(threads);
+    thread_counts.push_back(max_threads);
+
+    for (auto threads : thread_counts)
+    {
+        ct::set_parallel_concurrency(threads);
+        auto const suffix = " (" + std::to_string(threads) + " threads)";
+        bench
+            .run("constrained all_of par" + suffix, [&]{
+                constrained::parallel::run<ct::par>(parallel_data);
+            })
+            .run("constrained all_of par, failure at 10%" + suffix, [&]{
+                constrained::parallel::run<ct::par>(parallel_failing_data);
+            });
+    }
+    ct::set_parallel_concurrency(max_threads);
+
+    return suite::render_json(bench, argc, argv);
+}
@@ -0,0 +1,50 @@
+#include <string>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <params.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto const ints = params::make_ints();
+    auto const strings = params::make_strings();
+
+    auto bench = suite::make_bench("params");
+    bench
+        .batch(params::size)
+        .unit("value")
+        .run("manual simple value", [&]{
+            manual::params::run(ints, [](int x) { return x < 500; });
+        })
+        .run("constrained simple value", [&]{
+            constrained::params::run<params::value_t>(ints);
+        })
+        .run("manual runtime value", [&]{
+            manual::params::run(ints, [](int x) { return x < params::limit; });
+        })
+        .run("constrained runtime value", [&]{
+            constrained::params::run<params::runtime_t>(ints);
+        })
+        .run("manual combinator value", [&]{
+            manual::params::run(ints, [](int x) { return x < 500; });
+        })
+        .run("constrained combinator value", [&]{
+            constrained::params::run<params::combinator_t>(ints);
+        })
+        .run("manual object-callable value", [&]{
+            manual::params::run(ints, [](int x) { return x * 2 < 1000; });
+        })
+        .run("constrained object-callable value", [&]{
+            constrained::params::run<params::callable_t>(ints);
+        })
+        .run("manual member pointer", [&]{
+            manual::params::run(strings, [](std::string const & s) { return s.length() < 20; });
+        })
+        .run("constrained member pointer", [&]{
+            constrained::params::run<params::member_pointer_t>(strings);
+        });
+
+    return suite::render_json(bench, argc, argv);
+}
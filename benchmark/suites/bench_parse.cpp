@@ -0,0 +1,46 @@
+#include <string>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <parse.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto const parse_data = parse::make_data();
+    auto const parse_mixed_data = parse::make_mixed_data();
+    std::vector<int> raw_ports;
+    std::vector<parse::port_t> ports;
+    raw_ports.reserve(parse::count);
+    ports.reserve(parse::count);
+
+    auto bench = suite::make_bench("parse");
+    bench
+        .warmup(10)
+        .epochs(50)
+        .minEpochIterations(10)
+        .batch(parse_data.size())
+        .unit("byte")
+        .run("manual parse from_chars + range check", [&]{
+            manual::parse::run(parse_data, raw_ports);
+        })
+        .run("constrained parse from_chars + construct", [&]{
+            constrained::construct::parse::run(parse_data, ports);
+        })
+        .run("constrained parse_many", [&]{
+            constrained::parse::run(parse_data, ports);
+        })
+        .run("manual parse mixed from_chars + range check", [&]{
+            manual::parse::run_mixed(parse_mixed_data, raw_ports);
+        })
+        .run("constrained parse mixed from_chars + construct", [&]{
+            constrained::construct::parse::run_mixed(parse_mixed_data, ports);
+        })
+        .run("constrained parse mixed ct::parse", [&]{
+            constrained::parse::run_mixed(parse_mixed_data, ports);
+        });
+
+    return suite::render_json(bench, argc, argv);
+}
@@ -0,0 +1,37 @@
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <payloads.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto const strings = payloads::make_strings();
+    auto const vectors = payloads::make_vectors();
+
+    auto bench = suite::make_bench("payloads");
+    bench
+        .unit("value")
+        .batch(payloads::strings)
+        .run("manual string identifier", [&]{
+            manual::payloads::run_strings(strings);
+        })
+        .run("constrained string identifier", [&]{
+            constrained::payloads::run_strings(strings);
+        })
+        .run("manual string identifier from string_view", [&]{
+            manual::payloads::run_string_views(strings);
+        })
+        .run("constrained string identifier from string_view", [&]{
+            constrained::payloads::run_string_views(strings);
+        })
+        .batch(payloads::vectors)
+        .run("manual sorted vector", [&]{
+            manual::payloads::run_vectors(vectors);
+        })
+        .run("constrained sorted vector", [&]{
+            constrained::payloads::run_vectors(vectors);
+        });
+
+    return suite::render_json(bench, argc, argv);
+}
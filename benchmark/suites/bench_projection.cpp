@@ -0,0 +1,44 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <projection.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto const projection_data = projection::make_data();
+    std::vector<std::string_view> raw_records;
+    std::vector<projection::repeated_t> repeated_records;
+    std::vector<projection::shared_t> shared_records;
+    std::vector<projection::proj_t> proj_records;
+    raw_records.reserve(projection::count);
+    repeated_records.reserve(projection::count);
+    shared_records.reserve(projection::count);
+    proj_records.reserve(projection::count);
+
+    auto bench = suite::make_bench("projection");
+    bench
+        .warmup(10)
+        .epochs(50)
+        .minEpochIterations(10)
+        .batch(projection::count)
+        .unit("record")
+        .run("manual projection", [&]{
+            manual::projection::run(projection_data, raw_records);
+        })
+        .run("constrained repeated projection", [&]{
+            constrained::projection::run(projection_data, repeated_records);
+        })
+        .run("constrained shared projection", [&]{
+            constrained::projection::run(projection_data, shared_records);
+        })
+        .run("constrained proj", [&]{
+            constrained::projection::run(projection_data, proj_records);
+        });
+
+    return suite::render_json(bench, argc, argv);
+}
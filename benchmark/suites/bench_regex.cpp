@@ -0,0 +1,45 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <regex.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto const regex_identifiers = regex::make_identifiers();
+    auto const regex_emails = regex::make_emails();
+    std::regex const std_identifier{regex::identifier.data};
+    std::regex const std_email{regex::email.data};
+
+    auto bench = suite::make_bench("regex");
+    bench
+        .warmup(10)
+        .epochs(50)
+        .minEpochIterations(10)
+        .batch(regex::size)
+        .unit("string")
+        .run("std::regex identifier", [&]{
+            manual::regex::run_std_regex(regex_identifiers, std_identifier);
+        })
+        .run("manual identifier", [&]{
+            manual::regex::run(regex_identifiers, manual::regex::is_identifier);
+        })
+        .run("constrained identifier", [&]{
+            constrained::regex::run<regex::matches_t<regex::identifier>>(regex_identifiers);
+        })
+        .run("std::regex email", [&]{
+            manual::regex::run_std_regex(regex_emails, std_email);
+        })
+        .run("manual email", [&]{
+            manual::regex::run(regex_emails, manual::regex::is_email);
+        })
+        .run("constrained email", [&]{
+            constrained::regex::run<regex::matches_t<regex::email>>(regex_emails);
+        });
+
+    return suite::render_json(bench, argc, argv);
+}
@@ -0,0 +1,47 @@
+#include <string>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <sets.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto const sets_data = combinators::make_data();
+
+    auto bench = suite::make_bench("sets");
+    bench
+        .warmup(100)
+        .epochs(100)
+        .minEpochIterations(100)
+        .batch(combinators::size)
+        .unit("value")
+        .run("constrained and_<ge, le>", [&]{
+            constrained::combinators::run<sets::and_range_t<-500, 500>>(sets_data);
+        })
+        .run("constrained in_range", [&]{
+            constrained::combinators::run<sets::in_range_t<-500, 500>>(sets_data);
+        })
+        .run("constrained or_<eq...> (10 dense values)", [&]{
+            constrained::combinators::run<sets::dense_t<sets::chain_t>>(sets_data);
+        })
+        .run("constrained one_of bitmask (10 dense values)", [&]{
+            constrained::combinators::run<sets::dense_t<sets::one_of_t>>(sets_data);
+        })
+        .run("constrained or_<eq...> (24 values)", [&]{
+            constrained::combinators::run<sets::medium_t<sets::chain_t>>(sets_data);
+        })
+        .run("constrained one_of sorted table (24 values)", [&]{
+            constrained::combinators::run<sets::medium_t<sets::one_of_t>>(sets_data);
+        })
+        .run("constrained or_<eq...> (256 values)", [&]{
+            constrained::combinators::run<sets::large_t<sets::chain_t>>(sets_data);
+        })
+        .run("constrained one_of perfect hash (256 values)", [&]{
+            constrained::combinators::run<sets::large_t<sets::one_of_t>>(sets_data);
+        });
+
+    return suite::render_json(bench, argc, argv);
+}
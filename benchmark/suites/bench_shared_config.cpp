@@ -0,0 +1,45 @@
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <shared_config.hpp>
+
+int main(int argc, char ** argv)
+{
+    // 1, 2, 4, ... threads and all hardware threads
+    auto const max_threads = std::max(std::thread::hardware_concurrency(), 1U);
+    std::vector<unsigned> thread_counts;
+    for (unsigned threads = 1; threads < max_threads; threads *= 2)
+        thread_counts.push_back(threads);
+    thread_counts.push_back(max_threads);
+
+    manual::shared_config::config mutex_config;
+    ct::atomic<shared_config::limit_t> atomic_config{shared_config::limit_t{1}};
+
+    auto bench = suite::make_bench("shared config");
+    bench
+        .warmup(2)
+        .epochs(20)
+        .minEpochIterations(1)
+        .unit("op");
+
+    for (auto threads : thread_counts)
+    {
+        auto const suffix = " (" + std::to_string(threads) + " threads)";
+        bench
+            .batch(shared_config::ops * threads)
+            .run("manual shared config mutex" + suffix, [&]{
+                manual::shared_config::run(mutex_config, threads);
+            })
+            .run("constrained shared config ct::atomic" + suffix, [&]{
+                constrained::shared_config::run(atomic_config, threads);
+            });
+    }
+
+    return suite::render_json(bench, argc, argv);
+}
@@ -0,0 +1,53 @@
+#include <string>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <special_members.hpp>
+
+template <typename T>
+void add_cases(nb::Bench & bench, std::string const & type)
+{
+    using C = special_members::constrained_t<T>;
+
+    auto raw = special_members::make_data<T>();
+    auto raw_target = raw;
+    auto constrained = special_members::make_constrained_data<C>();
+    auto constrained_target = constrained;
+
+    bench
+        .run("manual copy construct " + type, [&]{
+            special_members::copy_construct(raw);
+        })
+        .run("constrained copy construct " + type, [&]{
+            special_members::copy_construct(constrained);
+        })
+        .run("manual copy assign " + type, [&]{
+            special_members::copy_assign(raw, raw_target);
+        })
+        .run("constrained copy assign " + type, [&]{
+            special_members::copy_assign(constrained, constrained_target);
+        })
+        .run("manual move construct and assign " + type, [&]{
+            special_members::move_round_trip(raw);
+        })
+        .run("constrained move construct and assign " + type, [&]{
+            special_members::move_round_trip(constrained);
+        });
+}
+
+int main(int argc, char ** argv)
+{
+    auto bench = suite::make_bench("special members");
+    bench
+        .batch(special_members::size)
+        .unit("value");
+
+    add_cases<int>(bench, "int");
+    add_cases<std::string>(bench, "string");
+    add_cases<std::vector<int>>(bench, "vector");
+
+    return suite::render_json(bench, argc, argv);
+}
@@ -0,0 +1,35 @@
+#include <string>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <static_table.hpp>
+
+int main(int argc, char ** argv)
+{
+    std::vector<int> raw_table;
+    std::vector<static_table::port_t> table;
+    raw_table.reserve(static_table::size);
+    table.reserve(static_table::size);
+
+    auto bench = suite::make_bench("static table");
+    bench
+        .warmup(100)
+        .epochs(100)
+        .minEpochIterations(100)
+        .batch(static_table::size)
+        .unit("entry")
+        .run("manual static table", [&]{
+            manual::static_table::run(raw_table);
+        })
+        .run("constrained table checked at runtime", [&]{
+            constrained::dynamic::static_table::run(table);
+        })
+        .run("constrained static table", [&]{
+            constrained::static_table::run(table);
+        });
+
+    return suite::render_json(bench, argc, argv);
+}
@@ -0,0 +1,47 @@
+#include <string>
+#include <vector>
+
+#include <nanobench.h>
+#include <constrained_type.hpp>
+
+#include <suite.hpp>
+#include <strings.hpp>
+
+int main(int argc, char ** argv)
+{
+    auto const strings_data = strings::make_data();
+
+    auto bench = suite::make_bench("strings");
+    bench
+        .warmup(10)
+        .epochs(50)
+        .minEpochIterations(10)
+        .batch(strings::fields)
+        .unit("field")
+        .run("std::string + lambda ascii", [&]{
+            strings::run_string<strings::string_ascii_t>(strings_data);
+        })
+        .run("string_view ascii", [&]{
+            strings::run_view<strings::view_ascii_t>(strings_data);
+        })
+        .run("std::string + lambda length and identifier charset", [&]{
+            strings::run_string<strings::string_identifier_t>(strings_data);
+        })
+        .run("string_view length_in and charset", [&]{
+            strings::run_view<strings::view_identifier_t>(strings_data);
+        })
+        .run("std::string + lambda no control chars", [&]{
+            strings::run_string<strings::string_no_control_t>(strings_data);
+        })
+        .run("string_view no_control_chars", [&]{
+            strings::run_view<strings::view_no_control_t>(strings_data);
+        })
+        .run("std::string + lambda utf8", [&]{
+            strings::run_string<strings::string_utf8_t>(strings_data);
+        })
+        .run("string_view utf8_valid", [&]{
+            strings::run_view<strings::view_utf8_t>(strings_data);
+        });
+
+    return suite::render_json(bench, argc, argv);
+}
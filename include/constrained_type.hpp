@@ -2,4 +2,11 @@
 
 #include <constrained_type/value_pack.hpp>
 #include <constrained_type/constrained_type.hpp>
-#include <constrained_type/combinators.hpp>
\ No newline at end of file
+#include <constrained_type/combinators.hpp>
+#include <constrained_type/validate.hpp>
+#include <constrained_type/constrained_vector.hpp>
+#include <constrained_type/bounded.hpp>
+#include <constrained_type/optional.hpp>
+#include <constrained_type/hash.hpp>
+#include <constrained_type/parse.hpp>
+#include <constrained_type/atomic.hpp>
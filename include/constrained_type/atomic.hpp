@@ -0,0 +1,209 @@
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <expected>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <constrained_type/constrained_type.hpp>
+
+namespace ct
+{
+    namespace detail
+    {
+        // Update of fetch_update returns either constrained value or raw candidate, which is checked
+        template <typename Update, typename ConstrainedType>
+        concept atomic_update =
+            std::invocable<Update &, ConstrainedType const &>
+            and (
+                std::same_as<std::remove_cvref_t<std::invoke_result_t<Update &, ConstrainedType const &>>, ConstrainedType>
+                or std::convertible_to<std::invoke_result_t<Update &, ConstrainedType const &>, typename ConstrainedType::value_type>
+            );
+
+        // The strongest order allowed for failed compare_exchange with the given success order
+        [[nodiscard]] constexpr auto failure_order(std::memory_order order) noexcept -> std::memory_order
+        {
+            switch (order)
+            {
+            case std::memory_order_acq_rel:
+                return std::memory_order_acquire;
+            case std::memory_order_release:
+                return std::memory_order_relaxed;
+            default:
+                return order;
+            }
+        }
+    } // namespace detail
+
+    /*
+     * Shared constrained value for trivially copyable T, lock-free if std::atomic<T> is
+     * Invalid value is never published: store and exchange accept only ConstrainedType,
+     * compare_exchange and fetch_update check raw candidates before CAS
+     * Loaded values are not checked again
+     */
+    template <constrained ConstrainedType>
+        requires std::is_trivially_copyable_v<typename ConstrainedType::value_type>
+    class atomic
+    {
+    public:
+        using value_type = ConstrainedType;
+
+        static constexpr bool is_always_lock_free = std::atomic<typename ConstrainedType::value_type>::is_always_lock_free;
+
+#pragma region constructors
+        constexpr atomic() noexcept(std::is_nothrow_default_constructible_v<ConstrainedType> and nothrow_raw)
+            requires std::is_default_constructible_v<ConstrainedType>
+            : atomic{ConstrainedType{}}
+        {}
+
+        constexpr atomic(ConstrainedType const & value) noexcept(nothrow_raw)
+            : _value{raw(value)}
+        {}
+
+        atomic(atomic const &) = delete;
+        auto operator=(atomic const &) -> atomic & = delete;
+#pragma endregion constructors
+
+        [[nodiscard]] auto is_lock_free() const noexcept -> bool
+        { return _value.is_lock_free(); }
+
+#pragma region operations
+        [[nodiscard]] auto load(std::memory_order order = std::memory_order_seq_cst) const noexcept -> ConstrainedType
+        { return make(_value.load(order)); }
+
+        operator ConstrainedType() const noexcept
+        { return load(); }
+
+        void store(ConstrainedType const & desired, std::memory_order order = std::memory_order_seq_cst) noexcept(nothrow_raw)
+        { _value.store(raw(desired), order); }
+
+        auto operator=(ConstrainedType const & desired) noexcept(nothrow_raw) -> ConstrainedType
+        {
+            store(desired);
+            return desired;
+        }
+
+        auto exchange(ConstrainedType const & desired, std::memory_order order = std::memory_order_seq_cst) noexcept(nothrow_raw) -> ConstrainedType
+        { return make(_value.exchange(raw(desired), order)); }
+
+        auto compare_exchange_weak(
+            ConstrainedType & expected,
+            ConstrainedType const & desired,
+            std::memory_order success,
+            std::memory_order failure
+        ) noexcept(nothrow_raw) -> bool
+        {
+            auto current = raw(expected);
+            bool const exchanged = _value.compare_exchange_weak(current, raw(desired), success, failure);
+            if (not exchanged)
+                expected = make(current);
+            return exchanged;
+        }
+
+        auto compare_exchange_weak(
+            ConstrainedType & expected,
+            ConstrainedType const & desired,
+            std::memory_order order = std::memory_order_seq_cst
+        ) noexcept(nothrow_raw) -> bool
+        { return compare_exchange_weak(expected, desired, order, detail::failure_order(order)); }
+
+        auto compare_exchange_strong(
+            ConstrainedType & expected,
+            ConstrainedType const & desired,
+            std::memory_order success,
+            std::memory_order failure
+        ) noexcept(nothrow_raw) -> bool
+        {
+            auto current = raw(expected);
+            bool const exchanged = _value.compare_exchange_strong(current, raw(desired), success, failure);
+            if (not exchanged)
+                expected = make(current);
+            return exchanged;
+        }
+
+        auto compare_exchange_strong(
+            ConstrainedType & expected,
+            ConstrainedType const & desired,
+            std::memory_order order = std::memory_order_seq_cst
+        ) noexcept(nothrow_raw) -> bool
+        { return compare_exchange_strong(expected, desired, order, detail::failure_order(order)); }
+
+        /*
+         * Strong compare_exchange with raw candidate, which is checked before CAS
+         * Failed candidate is returned as violation and the value is not touched
+         */
+        auto compare_exchange(
+            ConstrainedType & expected,
+            typename ConstrainedType::value_type const & desired,
+            std::memory_order order = std::memory_order_seq_cst
+        ) noexcept(noexcept(ConstrainedType::try_make(desired)) and nothrow_raw) -> std::expected<bool, violation>
+        {
+            auto candidate = ConstrainedType::try_make(desired);
+            if (not candidate)
+                return std::unexpected{candidate.error()};
+            return compare_exchange_strong(expected, *candidate, order);
+        }
+
+        /*
+         * Replaces value with update(current), update is called again if value was changed concurrently
+         * Raw candidates are checked before CAS, failed candidate is returned as violation and never published
+         * Returns previous value
+         */
+        template <detail::atomic_update<ConstrainedType> Update>
+        auto fetch_update(Update update, std::memory_order order = std::memory_order_seq_cst)
+            -> std::expected<ConstrainedType, violation>
+        {
+            auto current = _value.load(detail::failure_order(order));
+            while (true)
+            {
+                auto const previous = make(current);
+                auto candidate = check(std::invoke(update, previous));
+                if (not candidate)
+                    return std::unexpected{candidate.error()};
+                if (_value.compare_exchange_weak(current, raw(*candidate), order, detail::failure_order(order)))
+                    return previous;
+            }
+        }
+
+        void wait(ConstrainedType const & old, std::memory_order order = std::memory_order_seq_cst) const noexcept(nothrow_raw)
+        { _value.wait(raw(old), order); }
+
+        void notify_one() noexcept
+        { _value.notify_one(); }
+
+        void notify_all() noexcept
+        { _value.notify_all(); }
+#pragma endregion operations
+
+    private:
+        using raw_type = typename ConstrainedType::value_type;
+        using unchecked_tag = typename ConstrainedType::unchecked_tag;
+
+        // Reading value of lazy type runs its deferred checks
+        static constexpr bool nothrow_raw = noexcept(std::declval<ConstrainedType const &>().access());
+
+        [[nodiscard]] static constexpr auto raw(ConstrainedType const & x) noexcept(nothrow_raw) -> raw_type
+        { return x.access(); }
+
+        // Only validated values are stored, so loaded value is marked validated
+        [[nodiscard]] static constexpr auto make(raw_type const & x) noexcept -> ConstrainedType
+        {
+            ConstrainedType result{unchecked_tag{}, x};
+            result.mark_validated();
+            return result;
+        }
+
+        template <typename Candidate>
+        [[nodiscard]] static constexpr auto check(Candidate && candidate) -> std::expected<ConstrainedType, violation>
+        {
+            if constexpr (std::same_as<std::remove_cvref_t<Candidate>, ConstrainedType>)
+                return std::forward<Candidate>(candidate);
+            else
+                return ConstrainedType::try_make(static_cast<raw_type>(std::forward<Candidate>(candidate)));
+        }
+
+        std::atomic<raw_type> _value;
+    };
+} // namespace ct
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <limits>
+#include <optional>
+
+#include <constrained_type/constrained_type.hpp>
+#include <constrained_type/interval.hpp>
+#include <constrained_type/combinators/operators.hpp>
+
+namespace ct
+{
+    /*
+     * Integral value in [Lo, Hi]
+     * bounded<int, 0, 100> <=> constrained_type<int, in_range<0, 100>>
+     */
+    template <detail::interval_value T, T Lo, T Hi>
+    using bounded = constrained_type<T, in_range<Lo, Hi>>;
+
+    // Bounded value with the single value V, e.g. x * constant<2>
+    template <auto V>
+        requires detail::interval_value<decltype(V)>
+    inline constexpr bounded<decltype(V), V, V> constant{trusted, V};
+
+    namespace detail
+    {
+        /*
+         * Constrained integral type, which constraint pack bounds the value by an interval
+         * Nullable types are excluded, because null may be outside of the interval
+         */
+        template <typename C>
+        concept interval_constrained =
+            constrained<C>
+            and interval_value<typename C::value_type>
+            and not nullable<typename C::trait_type>
+            and pack_interval<typename C::value_type, typename C::constraint_pack>::value.bounded;
+
+        template <constrained C>
+        inline constexpr auto interval_of_type = pack_interval<typename C::value_type, typename C::constraint_pack>::value;
+
+        /*
+         * Constrained type with value in Interval, trait and configuration are taken from C
+         * Bounds are folded into single in_range
+         */
+        template <constrained C, auto Interval>
+        using interval_type = basic_constrained_type<
+            typename C::value_type,
+            typename C::trait_type,
+            C::config_value,
+            ct::in_range<Interval.lo, Interval.hi>
+        >;
+
+        // Operands of sampled or release debug_only types may be outside of their intervals
+        template <constrained... Operands>
+        inline constexpr bool checked_operands = (checks_every_value(Operands::config_value) && ...);
+
+        // Result is constructed without checks only if every operand was checked
+        template <constrained Result, constrained... Operands>
+        [[nodiscard]] constexpr auto make_interval_result(typename Result::value_type value) noexcept(checked_operands<Operands...>)
+            -> Result
+        {
+            if constexpr (checked_operands<Operands...>)
+                return Result{trusted, value};
+            else
+                return Result{value};
+        }
+
+#pragma region checked_arithmetic
+        // Arithmetic on T, nullopt if the result doesn't fit in T
+        template <interval_value T>
+        consteval auto checked_add(T x, T y) -> std::optional<T>
+        {
+            constexpr T min = std::numeric_limits<T>::min();
+            constexpr T max = std::numeric_limits<T>::max();
+            if (y > 0 ? x > static_cast<T>(max - y) : x < static_cast<T>(min - y))
+                return std::nullopt;
+            return static_cast<T>(x + y);
+        }
+
+        template <interval_value T>
+        consteval auto checked_sub(T x, T y) -> std::optional<T>
+        {
+            constexpr T min = std::numeric_limits<T>::min();
+            constexpr T max = std::numeric_limits<T>::max();
+            if (y > 0 ? x < static_cast<T>(min + y) : x > static_cast<T>(max + y))
+                return std::nullopt;
+            return static_cast<T>(x - y);
+        }
+
+        template <interval_value T>
+        consteval auto checked_mul(T x, T y) -> std::optional<T>
+        {
+            constexpr T min = std::numeric_limits<T>::min();
+            constexpr T max = std::numeric_limits<T>::max();
+            if (x == 0 or y == 0)
+                return T{0};
+
+            bool overflow;
+            if constexpr (std::is_unsigned_v<T>)
+                overflow = x > max / y;
+            else if (x > 0)
+                overflow = y > 0 ? x > max / y : y < min / x;
+            else
+                overflow = y > 0 ? x < min / y : y < max / x;
+
+            if (overflow)
+                return std::nullopt;
+            return static_cast<T>(x * y);
+        }
+
+        template <interval_value T>
+        consteval auto checked_div(T x, T y) -> std::optional<T>
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                if (x == std::numeric_limits<T>::min() and y == -1)
+                    return std::nullopt;
+            }
+            return static_cast<T>(x / y);
+        }
+#pragma endregion checked_arithmetic
+
+        /*
+         * Interval of x op y for x in X and y in Y, overflow is set if any result doesn't fit in T
+         * +, -, * and / by interval without zero are monotonic in each argument,
+         * so extremes and overflows are reached at corners
+         */
+        template <interval_value T>
+        struct interval_result
+        {
+            interval<T> value{};
+            bool overflow = false;
+        };
+
+        template <interval_value T, typename Op>
+        consteval auto corners(interval<T> const & x, interval<T> const & y, Op op) -> interval_result<T>
+        {
+            std::array<std::optional<T>, 4> const values{op(x.lo, y.lo), op(x.lo, y.hi), op(x.hi, y.lo), op(x.hi, y.hi)};
+
+            interval_result<T> result{{std::numeric_limits<T>::max(), std::numeric_limits<T>::min(), true, true}};
+            for (auto const & value : values)
+            {
+                if (not value)
+                    return {{}, true};
+                result.value.lo = std::min(result.value.lo, *value);
+                result.value.hi = std::max(result.value.hi, *value);
+            }
+            return result;
+        }
+
+        template <interval_value T>
+        consteval auto clamp_interval(interval<T> const & x, T lo, T hi) -> interval<T>
+        {
+            return {std::clamp(x.lo, lo, hi), std::clamp(x.hi, lo, hi), true, true};
+        }
+    } // namespace detail
+
+    /*
+     * Arithmetic on constrained integral types bounded by intervals
+     * Result interval is computed at compile time, e.g. [0, 100] + [0, 50] -> in_range<0, 150>,
+     * so result is constructed without checks (unless an operand's policy may skip checks)
+     * Operations, which may overflow T, don't compile
+     */
+#define CONSTRAINED_TYPE_INTERVAL_OPERATOR(op, checked_op, message) \
+    template <detail::interval_constrained X, detail::interval_constrained Y> \
+        requires std::same_as<typename X::value_type, typename Y::value_type> \
+    [[nodiscard]] constexpr auto operator op (X const & x, Y const & y) \
+        noexcept(noexcept(*x) and noexcept(*y) and detail::checked_operands<X, Y>) \
+    { \
+        using value_t = typename X::value_type; \
+        static_assert(not detail::interval_of_type<X>.empty() and not detail::interval_of_type<Y>.empty(), \
+            "Constraint pack is unsatisfiable"); \
+        constexpr auto result = detail::corners( \
+            detail::interval_of_type<X>, detail::interval_of_type<Y>, detail::checked_op<value_t> \
+        ); \
+        static_assert(not result.overflow, message); \
+        return detail::make_interval_result<detail::interval_type<X, result.value>, X, Y>(static_cast<value_t>(*x op *y)); \
+    }
+
+    CONSTRAINED_TYPE_INTERVAL_OPERATOR(+, checked_add, "Sum of bounded values may overflow value type")
+    CONSTRAINED_TYPE_INTERVAL_OPERATOR(-, checked_sub, "Difference of bounded values may overflow value type")
+    CONSTRAINED_TYPE_INTERVAL_OPERATOR(*, checked_mul, "Product of bounded values may overflow value type")
+
+#undef CONSTRAINED_TYPE_INTERVAL_OPERATOR
+
+    template <detail::interval_constrained X, detail::interval_constrained Y>
+        requires std::same_as<typename X::value_type, typename Y::value_type>
+    [[nodiscard]] constexpr auto operator/(X const & x, Y const & y)
+        noexcept(noexcept(*x) and noexcept(*y) and detail::checked_operands<X, Y>)
+    {
+        using value_t = typename X::value_type;
+        constexpr auto divisor = detail::interval_of_type<Y>;
+        static_assert(not detail::interval_of_type<X>.empty() and not divisor.empty(), "Constraint pack is unsatisfiable");
+        static_assert(divisor.lo > 0 or divisor.hi < 0, "Divisor interval contains zero");
+        constexpr auto result = detail::corners(detail::interval_of_type<X>, divisor, detail::checked_div<value_t>);
+        static_assert(not result.overflow, "Quotient of bounded values may overflow value type");
+        return detail::make_interval_result<detail::interval_type<X, result.value>, X, Y>(static_cast<value_t>(*x / *y));
+    }
+
+    template <detail::interval_constrained X>
+    [[nodiscard]] constexpr auto operator-(X const & x) noexcept(noexcept(*x) and detail::checked_operands<X>)
+    {
+        using value_t = typename X::value_type;
+        static_assert(not detail::interval_of_type<X>.empty(), "Constraint pack is unsatisfiable");
+        constexpr auto result = detail::corners(
+            detail::interval<value_t>{0, 0, true, true}, detail::interval_of_type<X>, detail::checked_sub<value_t>
+        );
+        static_assert(not result.overflow, "Negation of bounded value may overflow value type");
+        return detail::make_interval_result<detail::interval_type<X, result.value>, X>(static_cast<value_t>(-*x));
+    }
+
+    /*
+     * Clamps value to [Lo, Hi], result is bounded by intersection of [Lo, Hi] and the interval of x
+     */
+    template <auto Lo, auto Hi, detail::interval_constrained X>
+        requires (detail::is_exact_constant<typename X::value_type, Lo>() and detail::is_exact_constant<typename X::value_type, Hi>())
+    [[nodiscard]] constexpr auto clamp(X const & x) noexcept(noexcept(*x) and detail::checked_operands<X>)
+    {
+        using value_t = typename X::value_type;
+        constexpr auto lo = static_cast<value_t>(Lo);
+        constexpr auto hi = static_cast<value_t>(Hi);
+        static_assert(lo <= hi, "clamp requires Lo <= Hi");
+        static_assert(not detail::interval_of_type<X>.empty(), "Constraint pack is unsatisfiable");
+        constexpr auto result = detail::clamp_interval(detail::interval_of_type<X>, lo, hi);
+        return detail::make_interval_result<detail::interval_type<X, result>, X>(std::clamp(*x, lo, hi));
+    }
+
+    template <auto Lo, auto Hi, detail::interval_value T>
+        requires (detail::is_exact_constant<T, Lo>() and detail::is_exact_constant<T, Hi>())
+    [[nodiscard]] constexpr auto clamp(T x) noexcept -> bounded<T, static_cast<T>(Lo), static_cast<T>(Hi)>
+    {
+        static_assert(static_cast<T>(Lo) <= static_cast<T>(Hi), "clamp requires Lo <= Hi");
+        return {trusted, std::clamp(x, static_cast<T>(Lo), static_cast<T>(Hi))};
+    }
+} // namespace ct
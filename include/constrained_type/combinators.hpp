@@ -2,3 +2,9 @@
 
 #include <constrained_type/combinators/core.hpp>
 #include <constrained_type/combinators/operators.hpp>
+#include <constrained_type/combinators/memoized.hpp>
+#include <constrained_type/combinators/adaptive.hpp>
+#include <constrained_type/combinators/strings.hpp>
+#include <constrained_type/combinators/regex.hpp>
+#include <constrained_type/combinators/parallel.hpp>
+#include <constrained_type/combinators/projection.hpp>
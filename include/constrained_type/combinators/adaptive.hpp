@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <constrained_type/value_pack.hpp>
+#include <constrained_type/instrumentation.hpp>
+#include <constrained_type/combinators/core.hpp>
+
+namespace ct
+{
+    namespace detail
+    {
+        consteval auto factorial(std::size_t n) -> std::size_t
+        {
+            return n <= 1 ? 1 : n * factorial(n - 1);
+        }
+
+        // All permutations of 0..N-1 in lexicographic order
+        template <std::size_t N>
+        consteval auto orderings() -> std::array<std::array<std::uint8_t, N>, factorial(N)>
+        {
+            std::array<std::array<std::uint8_t, N>, factorial(N)> result{};
+            std::array<std::uint8_t, N> ordering{};
+            for (std::size_t i = 0; i < N; ++i)
+                ordering[i] = static_cast<std::uint8_t>(i);
+            for (auto & r : result)
+            {
+                r = ordering;
+                std::next_permutation(ordering.begin(), ordering.end());
+            }
+            return result;
+        }
+
+        /*
+         * and_, which reorders its arguments at runtime to reject values as cheap as possible
+         * Every sample_period-th call in a thread evaluates all arguments and measures their cost and rejections
+         * Every reorder_period samples arguments are sorted by cost / rejection rate
+         * Every ordering is a separate fully inlined evaluation, current one is picked by its index in table
+         */
+        template <auto... Args>
+            requires (sizeof...(Args) >= 2) and (sizeof...(Args) <= 4)
+        struct [[nodiscard]] adaptive_and final
+        {
+            using combinator_tag = void;
+
+            static constexpr std::size_t size = sizeof...(Args);
+            static constexpr std::uint32_t sample_period = 128;
+            static constexpr std::uint32_t reorder_period = 4;
+            static constexpr auto table = orderings<size>();
+
+            template <typename T>
+            struct statistics
+            {
+                std::size_t ordering = 0;
+                std::uint32_t countdown = sample_period;
+                std::uint32_t samples = 0;
+                std::array<std::uint64_t, size> ticks{};
+                std::array<std::uint64_t, size> rejections{};
+            };
+
+            [[nodiscard]] constexpr auto operator()(auto const & x) const -> bool
+            {
+                if consteval
+                {
+                    return (static_cast<bool>(apply<Args>(x)) && ...);
+                }
+                else
+                {
+                    using T = std::remove_cvref_t<decltype(x)>;
+                    auto & s = local<T>();
+                    if (--s.countdown != 0) [[likely]]
+                        return evaluate_ordered(s.ordering, x);
+                    s.countdown = sample_period;
+                    return sample(s, x);
+                }
+            }
+
+            // Ordering of arguments used in current thread for values of type T
+            template <typename T>
+            [[nodiscard]] static auto current_ordering() noexcept -> std::array<std::uint8_t, size>
+            {
+                return table[local<T>().ordering];
+            }
+
+        private:
+            template <typename T>
+            [[nodiscard]] static auto local() noexcept -> statistics<T> &
+            {
+                static thread_local statistics<T> s;
+                return s;
+            }
+
+            template <auto Arg, typename T>
+            [[nodiscard]] static constexpr auto evaluate(value_pack<Arg>, T const & x) -> bool
+            {
+                return static_cast<bool>(apply<Arg>(x));
+            }
+
+            template <std::size_t I, typename T>
+            [[nodiscard]] static constexpr auto evaluate(T const & x) -> bool
+            {
+                return evaluate(typename value_pack<Args...>::template get<I>{}, x);
+            }
+
+            template <typename T, std::size_t Ordering>
+            [[nodiscard]] static auto evaluate_ordered(T const & x) -> bool
+            {
+                return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    return (evaluate<table[Ordering][Is]>(x) && ...);
+                }(std::make_index_sequence<size>{});
+            }
+
+            // Current ordering rarely changes, so comparisons are predicted well and every ordering is inlined
+            template <typename T>
+            [[nodiscard]] static auto evaluate_ordered(std::size_t ordering, T const & x) -> bool
+            {
+                return [&]<std::size_t... Orderings>(std::index_sequence<Orderings...>) {
+                    bool result = false;
+                    static_cast<void>((
+                        (ordering == Orderings and (result = evaluate_ordered<T, Orderings>(x), true)) or ...
+                    ));
+                    return result;
+                }(std::make_index_sequence<table.size()>{});
+            }
+
+            template <typename T>
+            [[nodiscard]] static auto sample(statistics<T> & s, T const & x) -> bool
+            {
+                bool result = true;
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    ([&] {
+                        auto const start = ticks();
+                        bool const passed = evaluate<Is>(x);
+                        s.ticks[Is] += ticks() - start;
+                        s.rejections[Is] += not passed;
+                        result &= passed;
+                    }(), ...);
+                }(std::make_index_sequence<size>{});
+
+                if (++s.samples == reorder_period)
+                    reorder(s);
+                return result;
+            }
+
+            /*
+             * For independent predicates expected cost is minimal,
+             * if they are sorted by cost / rejection probability
+             */
+            template <typename T>
+            static void reorder(statistics<T> & s) noexcept
+            {
+                auto ordering = table[0];
+                std::stable_sort(ordering.begin(), ordering.end(), [&s](std::uint8_t i, std::uint8_t j) {
+                    if (s.rejections[i] == 0 or s.rejections[j] == 0)
+                        return s.rejections[i] != 0 or (s.rejections[j] == 0 and s.ticks[i] < s.ticks[j]);
+                    return s.ticks[i] * s.rejections[j] < s.ticks[j] * s.rejections[i];
+                });
+
+                s.ordering = static_cast<std::size_t>(std::find(table.begin(), table.end(), ordering) - table.begin());
+
+                // Old statistics fade, so order follows drifting input
+                s.samples = 0;
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    s.ticks[i] /= 2;
+                    s.rejections[i] /= 2;
+                }
+            }
+        };
+    } // namespace detail
+
+    /*
+     * Equivalent to and_<Args...> for pure independent predicates, which may be evaluated in any order
+     * Up to 4 arguments, nest adaptive_and for more
+     */
+    template <auto... Args>
+    inline constexpr auto adaptive_and = detail::adaptive_and<Args...>{};
+
+    /*
+     * Ordering of Adaptive arguments used in current thread for values of type T
+     */
+    template <auto Adaptive, typename T>
+    [[nodiscard]] auto adaptive_ordering() noexcept
+    {
+        return std::remove_cv_t<decltype(Adaptive)>::template current_ordering<T>();
+    }
+} // namespace ct
@@ -18,6 +18,36 @@ namespace ct
         typename T::combinator_tag;
     };
 
+    /*
+     * Combinator, which call operator is constrained, so it compiles for every argument it accepts
+     * Only such combinators are checked on views of values (see check_view_type)
+     */
+    template <typename T>
+    concept view_checkable_combinator =
+        combinator<T>
+        and requires { typename T::view_checkable_tag; };
+
+    /*
+     * Combinator, which is cheap and valid for every value (e.g. comparison with simple value)
+     * Only such combinators are evaluated without short-circuit by branchless checks
+     */
+    template <typename T>
+    concept cheap_combinator =
+        combinator<T>
+        and requires { requires T::is_cheap; };
+
+    namespace detail
+    {
+        // Simple values are used as is, never called or projected through
+        template <auto... Values>
+        inline constexpr bool simple_values = ((
+            std::is_arithmetic_v<decltype(Values)>
+            or std::is_enum_v<decltype(Values)>
+            or std::is_null_pointer_v<decltype(Values)>
+            or (std::is_pointer_v<decltype(Values)> and std::is_object_v<std::remove_pointer_t<decltype(Values)>>)
+        ) && ...);
+    }
+
     /*
      * We want to make sure, that lifted value is wrapped correctly
      * Also this unties us from val<V>
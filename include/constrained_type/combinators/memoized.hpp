@@ -0,0 +1,229 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <constrained_type/combinators/core.hpp>
+
+namespace ct
+{
+    /*
+     * Per-thread statistics of memoized combinator
+     */
+    struct memo_statistics
+    {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+    };
+
+    namespace detail
+    {
+        /*
+         * Copy of string of at most max_length characters stored inline
+         * Cache entries have fixed size, so memory of cache is bounded and views never dangle
+         */
+        template <typename CharT, typename Traits>
+        struct memo_string_key
+        {
+            using view_type = std::basic_string_view<CharT, Traits>;
+
+            static constexpr std::size_t max_length = 64;
+
+            [[nodiscard]] static constexpr auto fits(view_type s) noexcept -> bool
+            { return s.size() <= max_length; }
+
+            constexpr memo_string_key() noexcept = default;
+
+            // Requires fits(s)
+            constexpr explicit memo_string_key(view_type s) noexcept
+                : _size{static_cast<std::uint8_t>(s.size())}
+            { Traits::copy(_data.data(), s.data(), s.size()); }
+
+            [[nodiscard]] friend constexpr auto operator==(memo_string_key const & key, view_type s) noexcept -> bool
+            { return view_type{key._data.data(), key._size} == s; }
+
+        private:
+            std::array<CharT, max_length> _data{};
+            std::uint8_t _size = 0;
+        };
+
+        /*
+         * Type of cached keys. Strings are stored as bounded inline copies, longer strings are never cached
+         */
+        template <typename T>
+        struct memo_key
+        {
+            using type = T;
+
+            [[nodiscard]] static constexpr auto fits(T const &) noexcept -> bool
+            { return true; }
+        };
+
+        template <typename CharT, typename Traits>
+        struct memo_key<std::basic_string_view<CharT, Traits>>
+        {
+            using type = memo_string_key<CharT, Traits>;
+
+            [[nodiscard]] static constexpr auto fits(std::basic_string_view<CharT, Traits> s) noexcept -> bool
+            { return type::fits(s); }
+        };
+
+        template <typename CharT, typename Traits, typename Allocator>
+        struct memo_key<std::basic_string<CharT, Traits, Allocator>>
+        {
+            using type = memo_string_key<CharT, Traits>;
+
+            [[nodiscard]] static constexpr auto fits(std::basic_string_view<CharT, Traits> s) noexcept -> bool
+            { return type::fits(s); }
+        };
+
+        /*
+         * Fixed-size set-associative cache of predicate results
+         * One instance per thread, so no locking is needed
+         */
+        template <typename Memoized, typename T, std::size_t Capacity, std::size_t Ways>
+        class memo_cache
+        {
+        public:
+            using key_type = typename memo_key<T>::type;
+
+            static constexpr std::size_t sets = Capacity / Ways;
+
+            [[nodiscard]] static auto local() noexcept -> memo_cache &
+            {
+                static thread_local memo_cache cache;
+                return cache;
+            }
+
+            template <typename F>
+            [[nodiscard]] auto lookup(T const & x, F && compute) -> bool
+            {
+                if (not memo_key<T>::fits(x))
+                {
+                    ++_statistics.misses;
+                    return std::forward<F>(compute)();
+                }
+
+                std::uint64_t const hash = mix(std::hash<T>{}(x));
+                std::size_t const first = static_cast<std::size_t>(hash & (sets - 1)) * Ways;
+
+                for (std::size_t i = first; i < first + Ways; ++i)
+                {
+                    auto const & e = _entries[i];
+                    if (e.occupied and e.hash == hash and e.key == x)
+                    {
+                        ++_statistics.hits;
+                        return e.result;
+                    }
+                }
+
+                ++_statistics.misses;
+                bool const result = std::forward<F>(compute)();
+
+                // Round-robin replacement inside the set
+                auto & victim = _victims[first / Ways];
+                auto & e = _entries[first + victim];
+                victim = static_cast<std::uint8_t>((victim + 1) % Ways);
+
+                e.hash = hash;
+                e.key = key_type(x);
+                e.result = result;
+                e.occupied = true;
+                return result;
+            }
+
+            [[nodiscard]] auto statistics() const noexcept -> memo_statistics
+            { return _statistics; }
+
+            void clear() noexcept
+            {
+                for (auto & e : _entries)
+                    e.occupied = false;
+                _statistics = {};
+            }
+
+        private:
+            struct entry
+            {
+                std::uint64_t hash = 0;
+                key_type key{};
+                bool occupied = false;
+                bool result = false;
+            };
+
+            std::array<entry, Capacity> _entries{};
+            std::array<std::uint8_t, sets> _victims{};
+            memo_statistics _statistics;
+
+            // std::hash is identity for integers on common implementations, so spread bits over sets
+            [[nodiscard]] static constexpr auto mix(std::uint64_t h) noexcept -> std::uint64_t
+            {
+                h ^= h >> 33;
+                h *= 0xff51afd7ed558ccdULL;
+                h ^= h >> 33;
+                return h;
+            }
+        };
+
+        template <auto Pred, std::size_t Capacity, std::size_t Ways>
+            requires (Capacity % Ways == 0)
+                and (std::has_single_bit(Capacity / Ways))
+                and (Ways <= 255)
+        struct [[nodiscard]] memoized final
+        {
+            using combinator_tag = void;
+
+            template <typename T>
+            using cache_type = memo_cache<memoized, T, Capacity, Ways>;
+
+            [[nodiscard]] constexpr auto operator()(auto const & x) const -> bool
+            {
+                if consteval
+                {
+                    return static_cast<bool>(apply<Pred>(x));
+                }
+                else
+                {
+                    using T = std::remove_cvref_t<decltype(x)>;
+                    return cache_type<T>::local().lookup(x, [&x]{
+                        return static_cast<bool>(apply<Pred>(x));
+                    });
+                }
+            }
+        };
+    } // namespace detail
+
+    /*
+     * Caches results of expensive predicate Pred keyed by hash of checked value
+     * Cache holds Capacity entries in Ways-associative sets and is separate for each thread
+     * Pred must be pure, checked type must be hashable and equality comparable
+     */
+    template <auto Pred, std::size_t Capacity = 1024, std::size_t Ways = 4>
+    inline constexpr auto memoized = detail::memoized<Pred, Capacity, Ways>{};
+
+    /*
+     * Returns statistics of Memoized combinator for values of type T in current thread
+     */
+    template <auto Memoized, typename T>
+    [[nodiscard]] auto memo_stats() noexcept -> memo_statistics
+    {
+        using memoized_type = std::remove_cv_t<decltype(Memoized)>;
+        return memoized_type::template cache_type<T>::local().statistics();
+    }
+
+    /*
+     * Drops cached results and statistics of Memoized combinator for values of type T in current thread
+     */
+    template <auto Memoized, typename T>
+    void memo_clear() noexcept
+    {
+        using memoized_type = std::remove_cv_t<decltype(Memoized)>;
+        memoized_type::template cache_type<T>::local().clear();
+    }
+} // namespace ct
@@ -1,5 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
 #include <constrained_type/combinators/core.hpp>
 
 #define CONSTRAINED_TYPE_COMBINATOR_CONSTANT(name) \
@@ -31,6 +40,7 @@
         struct [[nodiscard]] name<A> final \
         { \
             using combinator_tag = void; \
+            static constexpr bool is_cheap = simple_values<A>; \
             \
             [[nodiscard]] constexpr auto operator()(auto const & x) const \
                 noexcept(noexcept(x op apply<A>(x))) \
@@ -100,4 +110,361 @@ namespace ct
         };
     }
     CONSTRAINED_TYPE_TEMPLATED_COMBINATOR_CONSTANT(if_);
+
+    /*
+     * Branchless variants of logical combinators
+     * Every argument is evaluated and results are combined with bitwise operators
+     * Arguments must be cheap, side-effect free and valid for every x
+     */
+    namespace detail
+    {
+        template <auto... Args>
+            requires (sizeof...(Args) > 0)
+        struct [[nodiscard]] branchless_and final
+        {
+            using combinator_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(auto const & x) const
+                noexcept(noexcept((static_cast<bool>(apply<Args>(x)) & ...)))
+                -> bool
+            { return (static_cast<bool>(apply<Args>(x)) & ...); }
+        };
+
+        template <auto... Args>
+            requires (sizeof...(Args) > 0)
+        struct [[nodiscard]] branchless_or final
+        {
+            using combinator_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(auto const & x) const
+                noexcept(noexcept((static_cast<bool>(apply<Args>(x)) | ...)))
+                -> bool
+            { return (static_cast<bool>(apply<Args>(x)) | ...); }
+        };
+
+        template <auto Cond, auto WhenTrue, auto WhenFalse>
+        struct [[nodiscard]] branchless_if final
+        {
+            using combinator_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(auto const & x) const
+                noexcept(noexcept(
+                    static_cast<bool>(apply<Cond>(x))
+                    and static_cast<bool>(apply<WhenTrue>(x))
+                    and static_cast<bool>(apply<WhenFalse>(x))
+                ))
+                -> bool
+            {
+                bool const cond = static_cast<bool>(apply<Cond>(x));
+                bool const when_true = static_cast<bool>(apply<WhenTrue>(x));
+                bool const when_false = static_cast<bool>(apply<WhenFalse>(x));
+                return (cond & when_true) | (!cond & when_false);
+            }
+        };
+    }
+    CONSTRAINED_TYPE_TEMPLATED_COMBINATOR_CONSTANT(branchless_and);
+    CONSTRAINED_TYPE_TEMPLATED_COMBINATOR_CONSTANT(branchless_or);
+    CONSTRAINED_TYPE_TEMPLATED_COMBINATOR_CONSTANT(branchless_if);
+
+    namespace detail
+    {
+        /*
+         * Checks if simple value A can be converted to T
+         * without changing the result of scalar comparison x op A for any x of type T
+         */
+        template <typename T, auto A>
+        consteval auto is_exact_constant() -> bool
+        {
+            using arg_t = std::remove_cv_t<decltype(A)>;
+            if constexpr (not std::is_arithmetic_v<T> or not std::is_arithmetic_v<arg_t> or std::same_as<arg_t, bool>)
+                return false;
+            else if constexpr (std::is_integral_v<T>)
+            {
+                using common_t = std::common_type_t<T, arg_t>;
+                if constexpr (not std::is_integral_v<arg_t>)
+                    return false;
+                else if constexpr (std::is_signed_v<T> and not std::is_signed_v<common_t>)
+                    return false;
+                else
+                    return static_cast<arg_t>(static_cast<T>(A)) == A
+                        and (A < arg_t{}) == (static_cast<T>(A) < T{});
+            }
+            else if constexpr (std::is_integral_v<arg_t>)
+                return true;
+            else
+                return static_cast<arg_t>(static_cast<T>(A)) == A;
+        }
+
+        template <typename T, auto... Values>
+        concept exact_integral_constants =
+            std::integral<T>
+            and not std::same_as<T, bool>
+            and (is_exact_constant<T, Values>() && ...);
+    }
+
+    /*
+     * Range combinator, Lo <= x <= Hi
+     * For integral x and simple values lowers to single comparison
+     */
+    namespace detail
+    {
+        template <auto Lo, auto Hi>
+        struct [[nodiscard]] in_range final
+        {
+            using combinator_tag = void;
+            static constexpr bool is_cheap = simple_values<Lo, Hi>;
+
+            // Values below Lo wrap around to values above Hi - Lo
+            template <typename T>
+                requires exact_integral_constants<T, Lo, Hi>
+            [[nodiscard]] constexpr auto operator()(T const & x) const noexcept -> bool
+            {
+                static_assert(static_cast<T>(Lo) <= static_cast<T>(Hi), "in_range requires Lo <= Hi");
+
+                using unsigned_t = std::make_unsigned_t<T>;
+                constexpr auto lo = static_cast<unsigned_t>(static_cast<T>(Lo));
+                constexpr auto width = static_cast<unsigned_t>(static_cast<unsigned_t>(static_cast<T>(Hi)) - lo);
+                return static_cast<unsigned_t>(static_cast<unsigned_t>(x) - lo) <= width;
+            }
+
+            [[nodiscard]] constexpr auto operator()(auto const & x) const
+                noexcept(noexcept(apply<Lo>(x) <= x and x <= apply<Hi>(x)))
+                -> bool
+            { return apply<Lo>(x) <= x and x <= apply<Hi>(x); }
+        };
+    }
+    CONSTRAINED_TYPE_TEMPLATED_COMBINATOR_CONSTANT(in_range);
+
+    /*
+     * Set membership combinator, x == V1 or ... or x == Vn
+     * For integral or enum x and simple values strategy is picked at compile time:
+     * bitmask      - every value is within 64 of the smallest one
+     * sorted       - up to sorted_set_max values, branchless binary search
+     * perfect_hash - larger sets, two-level hash without collisions
+     * Otherwise values are compared one by one
+     */
+    namespace detail
+    {
+        enum class set_strategy
+        {
+            chain,
+            bitmask,
+            sorted,
+            perfect_hash,
+        };
+
+        inline constexpr std::size_t sorted_set_max = 32;
+
+        template <typename T, auto... Values>
+        concept enum_constants =
+            std::is_enum_v<T>
+            and (std::same_as<std::remove_cv_t<decltype(Values)>, T> && ...);
+
+        template <typename T>
+        struct set_key
+        {
+            using type = T;
+        };
+
+        template <typename T>
+            requires std::is_enum_v<T>
+        struct set_key<T>
+        {
+            using type = std::underlying_type_t<T>;
+        };
+
+        /*
+         * Collision-free hash of Keys: key is mapped to bucket with seed 0,
+         * then to slot with per-bucket seed found at compile time
+         * Free slots hold Keys[0], so lookup is a single comparison
+         */
+        template <typename Key, std::size_t N, std::array<Key, N> Keys>
+        struct perfect_hash_set
+        {
+            using unsigned_t = std::make_unsigned_t<Key>;
+
+            static constexpr std::size_t slots = std::bit_ceil(N * 2);
+            static constexpr std::size_t buckets = std::bit_ceil((N + 3) / 4);
+
+            // splitmix64 finalizer
+            [[nodiscard]] static constexpr auto hash(Key key, std::uint64_t seed) noexcept -> std::uint64_t
+            {
+                std::uint64_t z = static_cast<std::uint64_t>(static_cast<unsigned_t>(key)) + seed * 0x9E3779B97F4A7C15;
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+                return z ^ (z >> 31);
+            }
+
+            struct table
+            {
+                std::array<Key, slots> keys{};
+                std::array<std::uint32_t, buckets> seeds{};
+            };
+
+            static consteval auto build() -> table
+            {
+                std::vector<std::vector<Key>> by_bucket(buckets);
+                for (auto key : Keys)
+                    by_bucket[hash(key, 0) & (buckets - 1)].push_back(key);
+
+                std::vector<std::size_t> order(buckets);
+                for (std::size_t i = 0; i < buckets; ++i)
+                    order[i] = i;
+                // Larger buckets are placed first, while most of slots are free
+                std::ranges::sort(order, [&by_bucket](auto x, auto y) {
+                    return by_bucket[x].size() != by_bucket[y].size()
+                        ? by_bucket[x].size() > by_bucket[y].size()
+                        : x < y;
+                });
+
+                table result;
+                result.keys.fill(Keys[0]);
+                std::array<bool, slots> used{};
+                for (auto bucket : order)
+                {
+                    auto const & keys = by_bucket[bucket];
+                    if (keys.empty())
+                        break;
+
+                    for (std::uint32_t seed = 1;; ++seed)
+                    {
+                        std::vector<std::size_t> taken;
+                        bool fits = true;
+                        for (auto key : keys)
+                        {
+                            auto const slot = hash(key, seed) & (slots - 1);
+                            if (used[slot] or std::ranges::find(taken, slot) != taken.end())
+                            {
+                                fits = false;
+                                break;
+                            }
+                            taken.push_back(slot);
+                        }
+                        if (not fits)
+                            continue;
+
+                        for (std::size_t i = 0; i < keys.size(); ++i)
+                        {
+                            used[taken[i]] = true;
+                            result.keys[taken[i]] = keys[i];
+                        }
+                        result.seeds[bucket] = seed;
+                        break;
+                    }
+                }
+                return result;
+            }
+
+            static constexpr table value = build();
+
+            [[nodiscard]] static constexpr auto contains(Key key) noexcept -> bool
+            {
+                auto const seed = value.seeds[hash(key, 0) & (buckets - 1)];
+                return value.keys[hash(key, seed) & (slots - 1)] == key;
+            }
+        };
+
+        template <typename Key, auto... Values>
+        struct integral_set
+        {
+            using unsigned_t = std::make_unsigned_t<Key>;
+
+            static constexpr auto sorted_values = []{
+                std::array<Key, sizeof...(Values)> values{static_cast<Key>(Values)...};
+                std::ranges::sort(values);
+                return values;
+            }();
+
+            static constexpr std::size_t size = []{
+                std::size_t count = 1;
+                for (std::size_t i = 1; i < sorted_values.size(); ++i)
+                    count += sorted_values[i] != sorted_values[i - 1];
+                return count;
+            }();
+
+            static constexpr auto keys = []{
+                std::array<Key, size> result{};
+                std::ranges::unique_copy(sorted_values, result.begin());
+                return result;
+            }();
+
+            static constexpr auto span = static_cast<unsigned_t>(static_cast<unsigned_t>(keys.back()) - static_cast<unsigned_t>(keys.front()));
+
+            static constexpr set_strategy strategy =
+                span < 64 ? set_strategy::bitmask
+                : size <= sorted_set_max ? set_strategy::sorted
+                : set_strategy::perfect_hash;
+
+            static constexpr std::uint64_t bitmask = []{
+                std::uint64_t result = 0;
+                if constexpr (span < 64)
+                {
+                    for (auto key : keys)
+                        result |= std::uint64_t{1} << static_cast<unsigned_t>(static_cast<unsigned_t>(key) - static_cast<unsigned_t>(keys.front()));
+                }
+                return result;
+            }();
+
+            [[nodiscard]] static constexpr auto contains(Key key) noexcept -> bool
+            {
+                if constexpr (strategy == set_strategy::bitmask)
+                {
+                    auto const offset = static_cast<unsigned_t>(static_cast<unsigned_t>(key) - static_cast<unsigned_t>(keys.front()));
+                    return (offset < 64) & static_cast<bool>((bitmask >> (offset & 63)) & 1);
+                }
+                else if constexpr (strategy == set_strategy::sorted)
+                {
+                    // Finds the last key <= key, the loop is unrolled for constant size
+                    Key const * base = keys.data();
+                    std::size_t n = size;
+                    while (n > 1)
+                    {
+                        std::size_t const half = n / 2;
+                        base = base[half] <= key ? base + half : base;
+                        n -= half;
+                    }
+                    return *base == key;
+                }
+                else
+                {
+                    return perfect_hash_set<Key, size, keys>::contains(key);
+                }
+            }
+        };
+
+        template <auto... Values>
+            requires (sizeof...(Values) > 0)
+        struct [[nodiscard]] one_of final
+        {
+            using combinator_tag = void;
+            static constexpr bool is_cheap = simple_values<Values...>;
+
+            template <typename T>
+                requires exact_integral_constants<T, Values...> or enum_constants<T, Values...>
+            [[nodiscard]] constexpr auto operator()(T const & x) const noexcept -> bool
+            {
+                using key_t = typename set_key<T>::type;
+                return integral_set<key_t, static_cast<key_t>(Values)...>::contains(static_cast<key_t>(x));
+            }
+
+            [[nodiscard]] constexpr auto operator()(auto const & x) const
+                noexcept(noexcept(((x == apply<Values>(x)) or ...)))
+                -> bool
+            { return ((x == apply<Values>(x)) or ...); }
+        };
+
+        // Strategy used by one_of<Values...> for type T
+        template <typename T, auto... Values>
+        consteval auto one_of_strategy() -> set_strategy
+        {
+            if constexpr (exact_integral_constants<T, Values...> or enum_constants<T, Values...>)
+            {
+                using key_t = typename set_key<T>::type;
+                return integral_set<key_t, static_cast<key_t>(Values)...>::strategy;
+            }
+            else
+                return set_strategy::chain;
+        }
+    }
+    CONSTRAINED_TYPE_TEMPLATED_COMBINATOR_CONSTANT(one_of);
 } // namespace ct
\ No newline at end of file
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <ranges>
+
+#include <constrained_type/combinators/core.hpp>
+#include <constrained_type/combinators/operators.hpp>
+#include <constrained_type/thread_pool.hpp>
+
+namespace ct
+{
+    /*
+     * Execution policy of range combinators
+     * Ranges of at least threshold elements are split into chunks of grain elements and checked by thread pool,
+     * smaller ranges are checked inline
+     */
+    struct execution
+    {
+        std::size_t threshold = std::numeric_limits<std::size_t>::max();
+        std::size_t grain = 16384;
+    };
+
+    // Never parallel
+    inline constexpr execution seq{};
+
+    // Parallel for ranges of at least 65536 elements
+    inline constexpr execution par{.threshold = 65536};
+
+    namespace detail
+    {
+        // Policy is either execution or size threshold
+        template <auto Policy>
+        consteval auto to_execution() -> execution
+        {
+            if constexpr (std::integral<decltype(Policy)>)
+                return execution{.threshold = static_cast<std::size_t>(Policy)};
+            else
+                return Policy;
+        }
+
+        /*
+         * Checks that every element of range satisfies Pred if Expected is true, or that none does
+         */
+        template <auto Pred, bool Expected, execution Policy>
+        struct range_check
+        {
+            // Elements in a block are combined without branches, so simple predicates are vectorized
+            static constexpr std::size_t block = 64;
+
+            [[nodiscard]] static constexpr auto element(auto const & x) -> bool
+            { return static_cast<bool>(apply<Pred>(x)) == Expected; }
+
+            [[nodiscard]] static constexpr auto sequential(std::ranges::input_range auto const & range) -> bool
+            {
+                if constexpr (std::ranges::contiguous_range<decltype(range)> and std::ranges::sized_range<decltype(range)>)
+                {
+                    auto const * data = std::ranges::data(range);
+                    auto const size = static_cast<std::size_t>(std::ranges::size(range));
+
+                    std::size_t i = 0;
+                    for (; i + block <= size; i += block)
+                    {
+                        bool satisfied = true;
+                        for (std::size_t k = 0; k < block; ++k)
+                            satisfied &= element(data[i + k]);
+                        if (not satisfied)
+                            return false;
+                    }
+                    for (; i < size; ++i)
+                    {
+                        if (not element(data[i]))
+                            return false;
+                    }
+                    return true;
+                }
+                else
+                {
+                    for (auto const & x : range)
+                    {
+                        if (not element(x))
+                            return false;
+                    }
+                    return true;
+                }
+            }
+
+            [[nodiscard]] static constexpr auto check(std::ranges::input_range auto const & range) -> bool
+            {
+                if consteval
+                {
+                    return sequential(range);
+                }
+                else
+                {
+                    using range_t = decltype(range);
+                    if constexpr (Policy.threshold != seq.threshold
+                        and std::ranges::random_access_range<range_t>
+                        and std::ranges::sized_range<range_t>)
+                    {
+                        auto const size = static_cast<std::size_t>(std::ranges::size(range));
+                        if (size >= Policy.threshold)
+                        {
+                            auto const first = std::ranges::begin(range);
+                            auto body = [first](std::size_t begin, std::size_t end) {
+                                using difference_t = std::iter_difference_t<decltype(first)>;
+                                return sequential(std::ranges::subrange(
+                                    first + static_cast<difference_t>(begin),
+                                    first + static_cast<difference_t>(end)
+                                ));
+                            };
+                            if (auto const result = parallel::pool::instance().run(size, Policy.grain, body))
+                                return *result;
+                        }
+                    }
+                    return sequential(range);
+                }
+            }
+        };
+
+        template <auto Pred, auto Policy = seq>
+        struct [[nodiscard]] all_of final
+        {
+            using combinator_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(std::ranges::input_range auto const & x) const -> bool
+            { return range_check<Pred, true, to_execution<Policy>()>::check(x); }
+        };
+
+        template <auto Pred, auto Policy = seq>
+        struct [[nodiscard]] any_of final
+        {
+            using combinator_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(std::ranges::input_range auto const & x) const -> bool
+            { return not range_check<Pred, false, to_execution<Policy>()>::check(x); }
+        };
+
+        template <auto Pred, auto Policy = seq>
+        struct [[nodiscard]] none_of final
+        {
+            using combinator_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(std::ranges::input_range auto const & x) const -> bool
+            { return range_check<Pred, false, to_execution<Policy>()>::check(x); }
+        };
+    } // namespace detail
+
+    /*
+     * Range combinators, Pred is applied to every element like arguments of other combinators
+     * Policy is execution or size threshold, e.g. all_of<gt<0>, par> or all_of<gt<0>, 100'000>
+     */
+    CONSTRAINED_TYPE_TEMPLATED_COMBINATOR_CONSTANT(all_of);
+    CONSTRAINED_TYPE_TEMPLATED_COMBINATOR_CONSTANT(any_of);
+    CONSTRAINED_TYPE_TEMPLATED_COMBINATOR_CONSTANT(none_of);
+} // namespace ct
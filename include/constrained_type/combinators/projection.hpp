@@ -0,0 +1,250 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+
+#include <constrained_type/value_pack.hpp>
+#include <constrained_type/combinators/core.hpp>
+#include <constrained_type/combinators/operators.hpp>
+
+namespace ct
+{
+    /*
+     * Projection combinator, evaluates Projection once and checks Constraints on its result
+     * proj<&std::string::length, gt<10>, lt<20>> <=> and_<gt<&std::string::length, 10>, lt<&std::string::length, 20>>
+     * Projection is anything callable with x: member pointer, lambda or combinator
+     */
+    namespace detail
+    {
+        template <auto Projection, auto... Constraints>
+            requires (sizeof...(Constraints) > 0)
+        struct [[nodiscard]] proj final
+        {
+            using combinator_tag = void;
+
+            // Checks constraints on already projected value, so projection can be shared with other constraints
+            [[nodiscard]] static constexpr auto check_projected(auto const & projected)
+                noexcept(noexcept((static_cast<bool>(apply<Constraints>(projected)) && ...)))
+                -> bool
+            { return (static_cast<bool>(apply<Constraints>(projected)) && ...); }
+
+            [[nodiscard]] constexpr auto operator()(auto const & x) const
+                noexcept(noexcept(check_projected(std::invoke(Projection, x))))
+                -> bool
+                requires std::invocable<decltype(Projection) const &, decltype(x)>
+            { return check_projected(std::invoke(Projection, x)); }
+        };
+    }
+    CONSTRAINED_TYPE_TEMPLATED_COMBINATOR_CONSTANT(proj);
+
+    namespace detail
+    {
+        template <auto Projection, typename T>
+        concept projection_for =
+            std::invocable<decltype(Projection) const &, T const &>
+            and not std::is_void_v<std::invoke_result_t<decltype(Projection) const &, T const &>>;
+
+        // Argument, which doesn't depend on x: simple value or wrapped runtime value
+        template <auto A, typename T>
+        concept constant_argument =
+            not combinator<std::remove_cv_t<decltype(A)>>
+            and not std::invocable<decltype(A) const &, T const &>;
+
+        /*
+         * Projection of constraint, which can be checked on projected value alone
+         * Relational combinators of projection and constant, e.g. gt<&std::string::length, 10>, and proj
+         * Every other constraint has no projection
+         */
+        template <typename Constraint, typename T>
+        struct projection_of
+        {
+            static constexpr bool exists = false;
+        };
+
+#define CONSTRAINED_TYPE_RELATIONAL_PROJECTION(name) \
+        template <auto P, auto A, typename T> \
+            requires projection_for<P, T> and constant_argument<A, T> \
+        struct projection_of<name<P, A>, T> \
+        { \
+            static constexpr bool exists = true; \
+            static constexpr auto projection = P; \
+            \
+            [[nodiscard]] static constexpr auto check(auto const & projected) \
+                noexcept(noexcept(static_cast<bool>(name<A>{}(projected)))) \
+                -> bool \
+            { return static_cast<bool>(name<A>{}(projected)); } \
+        };
+
+        CONSTRAINED_TYPE_RELATIONAL_PROJECTION(eq)
+        CONSTRAINED_TYPE_RELATIONAL_PROJECTION(neq)
+        CONSTRAINED_TYPE_RELATIONAL_PROJECTION(gt)
+        CONSTRAINED_TYPE_RELATIONAL_PROJECTION(ge)
+        CONSTRAINED_TYPE_RELATIONAL_PROJECTION(lt)
+        CONSTRAINED_TYPE_RELATIONAL_PROJECTION(le)
+
+#undef CONSTRAINED_TYPE_RELATIONAL_PROJECTION
+
+        template <auto P, auto... Constraints, typename T>
+            requires projection_for<P, T>
+        struct projection_of<proj<P, Constraints...>, T>
+        {
+            static constexpr bool exists = true;
+            static constexpr auto projection = P;
+
+            [[nodiscard]] static constexpr auto check(auto const & projected)
+                noexcept(noexcept(proj<P, Constraints...>::check_projected(projected)))
+                -> bool
+            { return proj<P, Constraints...>::check_projected(projected); }
+        };
+
+        /*
+         * Lazily evaluated projection of x
+         * Results returned by reference point to x's data, so they are not copied
+         */
+        template <auto Projection, typename T>
+        class projection_slot
+        {
+        public:
+            using result_type = std::invoke_result_t<decltype(Projection) const &, T const &>;
+
+            [[nodiscard]] constexpr auto get(T const & x)
+                noexcept(std::is_nothrow_invocable_v<decltype(Projection) const &, T const &>)
+                -> std::remove_reference_t<result_type> const &
+            {
+                if (not _value)
+                {
+                    if constexpr (by_reference)
+                        _value.emplace(std::addressof(std::invoke(Projection, x)));
+                    else
+                        _value.emplace(std::invoke(Projection, x));
+                }
+                if constexpr (by_reference)
+                    return **_value;
+                else
+                    return *_value;
+            }
+
+        private:
+            static constexpr bool by_reference = std::is_lvalue_reference_v<result_type>;
+
+            using stored_type = std::conditional_t<
+                by_reference,
+                std::remove_reference_t<result_type> *,
+                std::remove_cvref_t<result_type>
+            >;
+
+            std::optional<stored_type> _value;
+        };
+
+        template <typename... Packs>
+        struct concat_packs
+        {
+            using type = value_pack<>;
+        };
+
+        template <typename Pack, typename... Packs>
+        struct concat_packs<Pack, Packs...>
+        {
+            using type = typename Pack::template add_pack<typename concat_packs<Packs...>::type>;
+        };
+
+        // Projections used by more than one constraint of the pack, each of them once
+        template <typename T, typename ConstraintPack>
+        struct shared_projections;
+
+        template <typename T, auto... Constraints>
+        struct shared_projections<T, value_pack<Constraints...>>
+        {
+            template <auto Constraint>
+            static consteval auto projection_pack()
+            {
+                using projection_t = projection_of<std::remove_cv_t<decltype(Constraint)>, T>;
+                if constexpr (projection_t::exists)
+                    return value_pack<projection_t::projection>{};
+                else
+                    return value_pack<>{};
+            }
+
+            // Every projection in constraint order, with duplicates
+            using all = typename concat_packs<decltype(projection_pack<Constraints>())...>::type;
+
+            template <typename Unique>
+            struct filter;
+
+            template <auto... Projections>
+            struct filter<value_pack<Projections...>>
+            {
+                template <auto Projection>
+                static consteval auto count() -> std::size_t
+                { return all::size - all::template remove<Projection>::size; }
+
+                template <auto Projection>
+                using keep = std::conditional_t<(count<Projection>() > 1), value_pack<Projection>, value_pack<>>;
+
+                using type = typename concat_packs<keep<Projections>...>::type;
+            };
+
+            using type = typename filter<typename all::unique>::type;
+        };
+
+        /*
+         * Evaluates constraints of a pack on x, computing every shared projection at most once
+         * Constraints are evaluated in order, projection is computed by the first constraint using it
+         */
+        template <typename T, typename SharedProjections>
+        class projection_cache;
+
+        template <typename T, auto... Projections>
+        class projection_cache<T, value_pack<Projections...>>
+        {
+        public:
+            constexpr explicit projection_cache(T const & x) noexcept
+                : _x{x}
+            {}
+
+            template <auto Constraint>
+            [[nodiscard]] constexpr auto check()
+                noexcept(std::is_nothrow_invocable_v<decltype(Constraint) const &, T const &>)
+                -> bool
+            {
+                using projection_t = projection_of<std::remove_cv_t<decltype(Constraint)>, T>;
+                if constexpr (projection_t::exists)
+                {
+                    constexpr auto index = value_pack<Projections...>::template index_of<projection_t::projection>;
+                    if constexpr (index != sizeof...(Projections))
+                        return projection_t::check(std::get<index>(_slots).get(_x));
+                    else
+                        return static_cast<bool>(std::invoke(Constraint, _x));
+                }
+                else
+                    return static_cast<bool>(std::invoke(Constraint, _x));
+            }
+
+        private:
+            T const & _x;
+            std::tuple<projection_slot<Projections, T>...> _slots;
+        };
+
+        template <typename T, typename ConstraintPack>
+        struct projection_cache_for;
+
+        template <typename T, auto... Constraints>
+        struct projection_cache_for<T, value_pack<Constraints...>>
+        {
+            using type = projection_cache<T, typename shared_projections<T, value_pack<Constraints...>>::type>;
+        };
+    } // namespace detail
+
+    /*
+     * Projection cache for ConstraintPack checked on values of type T
+     * Constraints with the same projection (e.g. gt<&std::string::length, 10> and lt<&std::string::length, 20>)
+     * share its result
+     */
+    template <typename T, typename ConstraintPack>
+    using projection_cache = typename detail::projection_cache_for<T, ConstraintPack>::type;
+} // namespace ct
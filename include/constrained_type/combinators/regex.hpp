@@ -0,0 +1,719 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <constrained_type/combinators/core.hpp>
+#include <constrained_type/combinators/strings.hpp>
+
+namespace ct
+{
+    /*
+     * Compile-time regular expressions
+     *
+     * Pattern is compiled to minimized DFA during compilation, matching is a table-driven loop
+     * over bytes without allocations. Whole string must match, there are no anchors.
+     *
+     * Supported syntax:
+     * literal characters, '.' (any byte), '\' escapes of special characters
+     * classes [abc], [a-z], [^...], shorthands \d, \w, \s (also inside classes)
+     * grouping (...), alternation a|b
+     * quantifiers *, +, ?, {n}, {n,}, {n,m}
+     *
+     * Invalid pattern is a compilation error
+     */
+    namespace detail::regex
+    {
+        struct byte_set
+        {
+            std::array<std::uint64_t, 4> bits{};
+
+            constexpr void add(unsigned char c) noexcept
+            { bits[c / 64] |= std::uint64_t{1} << (c % 64); }
+
+            constexpr void add_range(unsigned char first, unsigned char last) noexcept
+            {
+                for (unsigned c = first; c <= last; ++c)
+                    add(static_cast<unsigned char>(c));
+            }
+
+            constexpr void invert() noexcept
+            {
+                for (auto & word : bits)
+                    word = ~word;
+            }
+
+            [[nodiscard]] constexpr auto contains(unsigned char c) const noexcept -> bool
+            { return (bits[c / 64] >> (c % 64)) & 1; }
+        };
+
+        // Pattern errors are reported as compilation errors through failed constant evaluation
+        [[noreturn]] inline void pattern_error(char const * message)
+        { throw std::invalid_argument{message}; }
+
+#pragma region parser
+        enum class node_kind
+        {
+            empty,
+            set,
+            concat,
+            alternation,
+            repeat,
+        };
+
+        inline constexpr int unbounded = -1;
+        inline constexpr int max_repeat = 1000;
+
+        struct node
+        {
+            node_kind kind = node_kind::empty;
+            byte_set set{};
+            int left = -1;
+            int right = -1;
+            int min = 0;
+            int max = 0;
+        };
+
+        class parser
+        {
+        public:
+            constexpr explicit parser(std::string_view pattern) noexcept
+                : _pattern{pattern}
+            {}
+
+            // Returns index of the root node
+            constexpr auto parse() -> int
+            {
+                int const root = alternation();
+                if (_pos != _pattern.size())
+                    pattern_error("Unmatched ')' in pattern");
+                return root;
+            }
+
+            [[nodiscard]] constexpr auto nodes() const noexcept -> std::vector<node> const &
+            { return _nodes; }
+
+        private:
+            std::string_view _pattern;
+            std::size_t _pos = 0;
+            std::vector<node> _nodes;
+
+            constexpr auto add(node n) -> int
+            {
+                _nodes.push_back(n);
+                return static_cast<int>(_nodes.size()) - 1;
+            }
+
+            [[nodiscard]] constexpr auto done() const noexcept -> bool
+            { return _pos == _pattern.size(); }
+
+            [[nodiscard]] constexpr auto peek() const noexcept -> char
+            { return done() ? '\0' : _pattern[_pos]; }
+
+            constexpr auto next() -> char
+            {
+                if (done())
+                    pattern_error("Unexpected end of pattern");
+                return _pattern[_pos++];
+            }
+
+            constexpr auto alternation() -> int
+            {
+                int result = concatenation();
+                while (not done() and peek() == '|')
+                {
+                    ++_pos;
+                    result = add({.kind = node_kind::alternation, .left = result, .right = concatenation()});
+                }
+                return result;
+            }
+
+            constexpr auto concatenation() -> int
+            {
+                int result = -1;
+                while (not done() and peek() != '|' and peek() != ')')
+                {
+                    int const item = repetition();
+                    result = result == -1 ? item : add({.kind = node_kind::concat, .left = result, .right = item});
+                }
+                return result == -1 ? add({.kind = node_kind::empty}) : result;
+            }
+
+            constexpr auto number() -> int
+            {
+                if (done() or peek() < '0' or peek() > '9')
+                    pattern_error("Expected number in quantifier");
+                int result = 0;
+                while (not done() and peek() >= '0' and peek() <= '9')
+                {
+                    result = result * 10 + (next() - '0');
+                    if (result > max_repeat)
+                        pattern_error("Quantifier is too large");
+                }
+                return result;
+            }
+
+            constexpr auto repetition() -> int
+            {
+                int result = atom();
+                while (not done())
+                {
+                    int min = 0;
+                    int max = unbounded;
+                    char const c = peek();
+                    if (c == '*')
+                        ++_pos;
+                    else if (c == '+')
+                    {
+                        ++_pos;
+                        min = 1;
+                    }
+                    else if (c == '?')
+                    {
+                        ++_pos;
+                        max = 1;
+                    }
+                    else if (c == '{')
+                    {
+                        ++_pos;
+                        min = number();
+                        max = min;
+                        if (peek() == ',')
+                        {
+                            ++_pos;
+                            max = peek() == '}' ? unbounded : number();
+                        }
+                        if (next() != '}')
+                            pattern_error("Expected '}' in quantifier");
+                        if (max != unbounded and max < min)
+                            pattern_error("Invalid quantifier range");
+                    }
+                    else
+                        break;
+                    result = add({.kind = node_kind::repeat, .left = result, .min = min, .max = max});
+                }
+                return result;
+            }
+
+            // Shorthand class for \d, \w, \s, returns false for other escapes
+            static constexpr auto shorthand(char c, byte_set & set) noexcept -> bool
+            {
+                switch (c)
+                {
+                    case 'd':
+                        set.add_range('0', '9');
+                        return true;
+                    case 'w':
+                        set.add_range('a', 'z');
+                        set.add_range('A', 'Z');
+                        set.add_range('0', '9');
+                        set.add('_');
+                        return true;
+                    case 's':
+                        for (char space : std::string_view{" \t\n\r\f\v"})
+                            set.add(static_cast<unsigned char>(space));
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+
+            static constexpr auto escaped(char c) noexcept -> char
+            {
+                switch (c)
+                {
+                    case 'n': return '\n';
+                    case 't': return '\t';
+                    case 'r': return '\r';
+                    case 'f': return '\f';
+                    case 'v': return '\v';
+                    case '0': return '\0';
+                    default: return c;
+                }
+            }
+
+            constexpr auto bracket() -> byte_set
+            {
+                byte_set set;
+                bool const negated = not done() and peek() == '^';
+                if (negated)
+                    ++_pos;
+
+                bool first = true;
+                while (first or peek() != ']')
+                {
+                    first = false;
+                    char c = next();
+                    if (c == '\\')
+                    {
+                        c = next();
+                        if (shorthand(c, set))
+                            continue;
+                        c = escaped(c);
+                    }
+
+                    if (_pos + 1 < _pattern.size() and peek() == '-' and _pattern[_pos + 1] != ']')
+                    {
+                        ++_pos;
+                        char last = next();
+                        if (last == '\\')
+                            last = escaped(next());
+                        if (static_cast<unsigned char>(last) < static_cast<unsigned char>(c))
+                            pattern_error("Invalid range in character class");
+                        set.add_range(static_cast<unsigned char>(c), static_cast<unsigned char>(last));
+                    }
+                    else
+                        set.add(static_cast<unsigned char>(c));
+
+                    if (done())
+                        pattern_error("Unmatched '[' in pattern");
+                }
+                ++_pos;
+
+                if (negated)
+                    set.invert();
+                return set;
+            }
+
+            constexpr auto atom() -> int
+            {
+                char const c = next();
+                byte_set set;
+                switch (c)
+                {
+                    case '(':
+                    {
+                        int const inner = alternation();
+                        if (done() or next() != ')')
+                            pattern_error("Unmatched '(' in pattern");
+                        return inner;
+                    }
+                    case '[':
+                        set = bracket();
+                        break;
+                    case '.':
+                        set.invert();
+                        break;
+                    case '\\':
+                    {
+                        char const e = next();
+                        if (not shorthand(e, set))
+                            set.add(static_cast<unsigned char>(escaped(e)));
+                        break;
+                    }
+                    case '*':
+                    case '+':
+                    case '?':
+                    case '{':
+                        pattern_error("Quantifier without operand");
+                    case '^':
+                    case '$':
+                        pattern_error("Anchors are not supported, whole string is always matched");
+                    default:
+                        set.add(static_cast<unsigned char>(c));
+                }
+                return add({.kind = node_kind::set, .set = set});
+            }
+        };
+#pragma endregion parser
+
+#pragma region automata
+        // Thompson NFA, every state has epsilon edges and at most one byte edge
+        struct nfa
+        {
+            struct state
+            {
+                std::vector<int> epsilon;
+                int set = -1;
+                int target = -1;
+            };
+
+            struct fragment
+            {
+                int start;
+                int end;
+            };
+
+            std::vector<state> states;
+            std::vector<byte_set> sets;
+            int start = 0;
+            int accept = 0;
+
+            constexpr auto add_state() -> int
+            {
+                states.emplace_back();
+                return static_cast<int>(states.size()) - 1;
+            }
+
+            constexpr void link(int from, int to)
+            { states[from].epsilon.push_back(to); }
+
+            constexpr auto emit(std::vector<node> const & nodes, int index) -> fragment
+            {
+                node const & n = nodes[index];
+                switch (n.kind)
+                {
+                    case node_kind::empty:
+                    {
+                        int const s = add_state();
+                        return {s, s};
+                    }
+                    case node_kind::set:
+                    {
+                        int const s = add_state();
+                        int const e = add_state();
+                        sets.push_back(n.set);
+                        states[s].set = static_cast<int>(sets.size()) - 1;
+                        states[s].target = e;
+                        return {s, e};
+                    }
+                    case node_kind::concat:
+                    {
+                        auto const a = emit(nodes, n.left);
+                        auto const b = emit(nodes, n.right);
+                        link(a.end, b.start);
+                        return {a.start, b.end};
+                    }
+                    case node_kind::alternation:
+                    {
+                        int const s = add_state();
+                        auto const a = emit(nodes, n.left);
+                        auto const b = emit(nodes, n.right);
+                        int const e = add_state();
+                        link(s, a.start);
+                        link(s, b.start);
+                        link(a.end, e);
+                        link(b.end, e);
+                        return {s, e};
+                    }
+                    case node_kind::repeat:
+                    default:
+                    {
+                        int const s = add_state();
+                        int current = s;
+                        for (int i = 0; i < n.min; ++i)
+                        {
+                            auto const f = emit(nodes, n.left);
+                            link(current, f.start);
+                            current = f.end;
+                        }
+
+                        int const e = add_state();
+                        if (n.max == unbounded)
+                        {
+                            auto const f = emit(nodes, n.left);
+                            link(current, f.start);
+                            link(current, e);
+                            link(f.end, current);
+                        }
+                        else
+                        {
+                            for (int i = n.min; i < n.max; ++i)
+                            {
+                                auto const f = emit(nodes, n.left);
+                                link(current, e);
+                                link(current, f.start);
+                                current = f.end;
+                            }
+                        }
+                        link(current, e);
+                        return {s, e};
+                    }
+                }
+            }
+
+            // Sorted set of states reachable from states by epsilon edges
+            constexpr auto closure(std::vector<int> states_set) const -> std::vector<int>
+            {
+                std::vector<bool> seen(states.size());
+                std::vector<int> stack = states_set;
+                for (int s : states_set)
+                    seen[s] = true;
+                while (not stack.empty())
+                {
+                    int const s = stack.back();
+                    stack.pop_back();
+                    for (int t : states[s].epsilon)
+                    {
+                        if (not seen[t])
+                        {
+                            seen[t] = true;
+                            states_set.push_back(t);
+                            stack.push_back(t);
+                        }
+                    }
+                }
+                std::ranges::sort(states_set);
+                return states_set;
+            }
+        };
+
+        struct automaton
+        {
+            std::array<std::uint8_t, 256> byte_class{};
+            std::size_t classes = 0;
+            std::size_t states = 0;
+            std::vector<std::uint16_t> next;
+            std::vector<bool> accepting;
+            std::uint16_t start = 0;
+        };
+
+        // Bytes are in the same class if every set of nfa either contains all of them or none
+        constexpr void compute_classes(nfa const & n, automaton & result)
+        {
+            std::array<int, 256> ids{};
+            int count = 1;
+            for (auto const & set : n.sets)
+            {
+                std::array<int, 512> remap{};
+                remap.fill(-1);
+                int next_count = 0;
+                for (std::size_t c = 0; c < 256; ++c)
+                {
+                    int & id = remap[ids[c] * 2 + set.contains(static_cast<unsigned char>(c))];
+                    if (id == -1)
+                        id = next_count++;
+                    ids[c] = id;
+                }
+                count = next_count;
+            }
+            for (std::size_t c = 0; c < 256; ++c)
+                result.byte_class[c] = static_cast<std::uint8_t>(ids[c]);
+            result.classes = static_cast<std::size_t>(count);
+        }
+
+        // Subset construction, the empty set of nfa states becomes the dead state
+        constexpr auto determinize(nfa const & n, automaton & result) -> std::vector<std::vector<int>>
+        {
+            std::array<unsigned char, 256> representative{};
+            for (std::size_t c = 256; c-- > 0;)
+                representative[result.byte_class[c]] = static_cast<unsigned char>(c);
+
+            std::vector<std::vector<int>> subsets{n.closure({n.start})};
+            std::vector<std::vector<int>> transitions;
+            for (std::size_t i = 0; i < subsets.size(); ++i)
+            {
+                std::vector<int> row(result.classes);
+                for (std::size_t k = 0; k < result.classes; ++k)
+                {
+                    std::vector<int> moved;
+                    for (int s : subsets[i])
+                    {
+                        auto const & state = n.states[s];
+                        if (state.set != -1 and n.sets[state.set].contains(representative[k]))
+                            moved.push_back(state.target);
+                    }
+                    moved = n.closure(moved);
+
+                    auto const found = std::ranges::find(subsets, moved);
+                    row[k] = static_cast<int>(found - subsets.begin());
+                    if (found == subsets.end())
+                        subsets.push_back(moved);
+                }
+                transitions.push_back(row);
+            }
+
+            result.states = subsets.size();
+            result.accepting.resize(subsets.size());
+            for (std::size_t i = 0; i < subsets.size(); ++i)
+                result.accepting[i] = std::ranges::binary_search(subsets[i], n.accept);
+            return transitions;
+        }
+
+        // Moore partition refinement, states are renumbered by their class
+        constexpr void minimize(std::vector<std::vector<int>> const & transitions, automaton & result)
+        {
+            std::size_t const size = transitions.size();
+            std::vector<int> part(size);
+            for (std::size_t i = 0; i < size; ++i)
+                part[i] = result.accepting[i] ? 1 : 0;
+
+            // Counted repeats like {8,64} need a round per repetition, so states are grouped by sorting signatures
+            std::size_t const width = result.classes + 1;
+            std::vector<int> signatures(size * width);
+            auto const compare = [&signatures, width](std::size_t x, std::size_t y) {
+                for (std::size_t k = 0; k < width; ++k)
+                {
+                    if (signatures[x * width + k] != signatures[y * width + k])
+                        return signatures[x * width + k] < signatures[y * width + k] ? -1 : 1;
+                }
+                return 0;
+            };
+            std::vector<std::size_t> order(size);
+            for (std::size_t i = 0; i < size; ++i)
+                order[i] = i;
+
+            std::size_t parts = 0;
+            while (true)
+            {
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    signatures[i * width] = part[i];
+                    for (std::size_t k = 0; k < result.classes; ++k)
+                        signatures[i * width + 1 + k] = part[transitions[i][k]];
+                }
+                std::sort(order.begin(), order.end(), [&compare](std::size_t x, std::size_t y) { return compare(x, y) < 0; });
+
+                int refined = 0;
+                for (std::size_t j = 0; j < size; ++j)
+                {
+                    if (j > 0 and compare(order[j - 1], order[j]) != 0)
+                        ++refined;
+                    part[order[j]] = refined;
+                }
+                auto const refined_parts = static_cast<std::size_t>(refined) + 1;
+                if (refined_parts == parts)
+                    break;
+                parts = refined_parts;
+            }
+
+            if (parts > 0xFFFF)
+                pattern_error("Pattern produces too many states");
+
+            std::vector<std::uint16_t> next(parts * result.classes);
+            std::vector<bool> accepting(parts);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                auto const p = static_cast<std::size_t>(part[i]);
+                accepting[p] = result.accepting[i];
+                for (std::size_t k = 0; k < result.classes; ++k)
+                    next[p * result.classes + k] = static_cast<std::uint16_t>(part[transitions[i][k]]);
+            }
+
+            result.states = parts;
+            result.next = next;
+            result.accepting = accepting;
+            result.start = static_cast<std::uint16_t>(part[0]);
+        }
+
+        constexpr auto compile(std::string_view pattern) -> automaton
+        {
+            parser p{pattern};
+            int const root = p.parse();
+
+            nfa n;
+            auto const f = n.emit(p.nodes(), root);
+            n.start = f.start;
+            n.accept = f.end;
+
+            automaton result;
+            compute_classes(n, result);
+            minimize(determinize(n, result), result);
+            return result;
+        }
+#pragma endregion automata
+
+        // Upper bound of transition table size (states * byte classes) of compiled pattern
+        inline constexpr std::size_t max_transitions = std::size_t{1} << 16;
+
+        /*
+         * Minimized DFA in arrays of fixed capacity, so it can be stored in a constant
+         * States not accepting anything are collapsed into a single dead state, matching stops there
+         */
+        struct fixed_automaton
+        {
+            static constexpr std::uint16_t no_state = 0xFFFF;
+
+            std::array<std::uint8_t, 256> byte_class{};
+            std::size_t classes = 0;
+            std::size_t states = 0;
+            std::array<std::uint16_t, max_transitions> next{};
+            std::array<bool, max_transitions> accepting{};
+            std::uint16_t start = 0;
+            std::uint16_t dead = no_state;
+        };
+
+        constexpr auto compile_fixed(std::string_view pattern) -> fixed_automaton
+        {
+            auto const a = compile(pattern);
+            if (a.states * a.classes > max_transitions)
+                pattern_error("Pattern produces too many states");
+
+            fixed_automaton result;
+            result.byte_class = a.byte_class;
+            result.classes = a.classes;
+            result.states = a.states;
+            std::ranges::copy(a.next, result.next.begin());
+            std::ranges::copy(a.accepting, result.accepting.begin());
+            result.start = a.start;
+
+            for (std::size_t s = 0; s < a.states; ++s)
+            {
+                bool const sink = std::ranges::all_of(
+                    std::span{result.next}.subspan(s * a.classes, a.classes),
+                    [s](auto t) { return t == s; }
+                );
+                if (sink and not result.accepting[s])
+                    result.dead = static_cast<std::uint16_t>(s);
+            }
+            return result;
+        }
+
+        /*
+         * Tables of minimized DFA for Pattern
+         * Pattern is compiled once, tables of exact size are copied from the fixed capacity automaton
+         */
+        template <fixed_string Pattern>
+        struct dfa
+        {
+            static constexpr fixed_automaton compiled = compile_fixed(Pattern.view());
+
+            static constexpr std::size_t states = compiled.states;
+            static constexpr std::size_t classes = compiled.classes;
+
+            struct tables
+            {
+                std::array<std::uint8_t, 256> byte_class{};
+                std::array<std::uint16_t, states * classes> next{};
+                std::array<bool, states> accepting{};
+                std::uint16_t start = 0;
+                std::uint16_t dead = fixed_automaton::no_state;
+            };
+
+            static constexpr tables value = []{
+                tables result;
+                result.byte_class = compiled.byte_class;
+                std::ranges::copy_n(compiled.next.begin(), states * classes, result.next.begin());
+                std::ranges::copy_n(compiled.accepting.begin(), states, result.accepting.begin());
+                result.start = compiled.start;
+                result.dead = compiled.dead;
+                return result;
+            }();
+
+            [[nodiscard]] static constexpr auto match(std::string_view s) noexcept -> bool
+            {
+                std::size_t state = value.start;
+                for (char c : s)
+                {
+                    state = value.next[state * classes + value.byte_class[static_cast<unsigned char>(c)]];
+                    if (state == value.dead)
+                        return false;
+                }
+                return value.accepting[state];
+            }
+        };
+    } // namespace detail::regex
+
+    namespace detail
+    {
+        template <fixed_string Pattern>
+        struct [[nodiscard]] matches final
+        {
+            using combinator_tag = void;
+            using view_checkable_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(string_like auto const & x) const noexcept -> bool
+            { return regex::dfa<Pattern>::match(std::string_view{x}); }
+        };
+    }
+
+    // Whole string matches Pattern, e.g. matches<"[A-Za-z_]\\w*">
+    template <fixed_string Pattern>
+    inline constexpr auto matches = detail::matches<Pattern>{};
+} // namespace ct
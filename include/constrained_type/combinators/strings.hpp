@@ -0,0 +1,523 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <constrained_type/simd.hpp>
+#include <constrained_type/combinators/core.hpp>
+#include <constrained_type/combinators/operators.hpp>
+
+// Position of the first non-ASCII byte is read from mask words in memory order, which holds on little-endian targets only
+#if defined(CONSTRAINED_TYPE_VECTOR_KERNELS) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    #define CONSTRAINED_TYPE_VECTOR_ASCII_PREFIX 1
+#endif
+
+namespace ct
+{
+    /*
+     * String literal usable as template argument, e.g. starts_with<"https://">
+     */
+    template <std::size_t N>
+    struct fixed_string
+    {
+        char data[N] = {};
+
+        consteval fixed_string(char const (&str)[N]) noexcept
+        { std::copy_n(str, N, data); }
+
+        [[nodiscard]] static constexpr auto size() noexcept -> std::size_t
+        { return N - 1; }
+
+        [[nodiscard]] constexpr auto view() const noexcept -> std::string_view
+        { return {data, N - 1}; }
+    };
+
+    /*
+     * Anything viewable as std::string_view: std::string_view, std::string, char const *
+     * String combinators never copy their argument
+     */
+    template <typename T>
+    concept string_like = std::convertible_to<T const &, std::string_view>;
+
+    namespace detail::strings
+    {
+        /*
+         * Byte kernel describes predicate every byte of a string must satisfy
+         * element    - type of vector lanes
+         * vectorized - vector(x, mask) is provided
+         * scalar(c)  - checks single byte
+         * vector(x, mask) - stores lane-wise result for vector x of element
+         */
+        template <typename Kernel>
+        [[nodiscard]] constexpr auto scalar_all_of(std::string_view s)
+            noexcept(Kernel::nothrow) -> bool
+        {
+            for (char c : s)
+            {
+                if (not Kernel::scalar(c))
+                    return false;
+            }
+            return true;
+        }
+
+        [[nodiscard]] constexpr auto scalar_ascii_prefix(std::string_view s) noexcept -> std::size_t
+        {
+            std::size_t i = 0;
+            while (i < s.size() and static_cast<unsigned char>(s[i]) < 0x80)
+                ++i;
+            return i;
+        }
+
+#if defined(CONSTRAINED_TYPE_VECTOR_KERNELS)
+        // Mask lanes are either 0 or all ones, so mask can be inspected as 64-bit words
+        template <typename Mask>
+        [[nodiscard]] [[gnu::always_inline]] inline auto mask_words(Mask const & mask) noexcept
+        {
+            std::array<std::uint64_t, sizeof(Mask) / sizeof(std::uint64_t)> words;
+            std::memcpy(words.data(), &mask, sizeof(Mask));
+            return words;
+        }
+
+        // Requires s.size() >= Bytes, the last block overlaps the previous one instead of scalar tail
+        template <typename Kernel, std::size_t Bytes>
+        [[nodiscard]] [[gnu::always_inline]] inline auto vector_all_of(std::string_view s) noexcept -> bool
+        {
+            using vec = typename simd_vector<typename Kernel::element, Bytes>::type;
+            using mask = decltype(std::declval<vec>() == std::declval<vec>());
+
+            mask failed{};
+            auto const block = [&s, &failed](std::size_t offset) {
+                vec x;
+                std::memcpy(&x, s.data() + offset, Bytes);
+                mask m;
+                Kernel::vector(x, m);
+                failed |= ~m;
+            };
+
+            std::size_t i = 0;
+            for (; i + Bytes <= s.size(); i += Bytes)
+                block(i);
+            if (i < s.size())
+                block(s.size() - Bytes);
+
+            std::uint64_t any = 0;
+            for (auto word : mask_words(failed))
+                any |= word;
+            return any == 0;
+        }
+
+    #if defined(CONSTRAINED_TYPE_VECTOR_ASCII_PREFIX)
+        template <std::size_t Bytes>
+        [[nodiscard]] [[gnu::always_inline]] inline auto vector_ascii_prefix(std::string_view s) noexcept -> std::size_t
+        {
+            using vec = typename simd_vector<unsigned char, Bytes>::type;
+
+            std::size_t i = 0;
+            for (; i + Bytes <= s.size(); i += Bytes)
+            {
+                vec x;
+                std::memcpy(&x, s.data() + i, Bytes);
+                auto const words = mask_words(x >= static_cast<unsigned char>(0x80));
+                for (std::size_t w = 0; w < words.size(); ++w)
+                {
+                    if (words[w] != 0)
+                        return i + w * 8 + static_cast<std::size_t>(std::countr_zero(words[w])) / 8;
+                }
+            }
+            return i + scalar_ascii_prefix(s.substr(i));
+        }
+    #endif
+
+        template <typename Kernel>
+        [[nodiscard]] inline auto sse2_all_of(std::string_view s) noexcept -> bool
+        { return vector_all_of<Kernel, 16>(s); }
+
+    #if defined(CONSTRAINED_TYPE_VECTOR_ASCII_PREFIX)
+        [[nodiscard]] inline auto sse2_ascii_prefix(std::string_view s) noexcept -> std::size_t
+        { return vector_ascii_prefix<16>(s); }
+    #endif
+
+    #if defined(CONSTRAINED_TYPE_AVX2_DISPATCH)
+        template <typename Kernel>
+        [[nodiscard]] [[gnu::target("avx2")]] inline auto avx2_all_of(std::string_view s) noexcept -> bool
+        { return vector_all_of<Kernel, 32>(s); }
+
+        #if defined(CONSTRAINED_TYPE_VECTOR_ASCII_PREFIX)
+        [[nodiscard]] [[gnu::target("avx2")]] inline auto avx2_ascii_prefix(std::string_view s) noexcept -> std::size_t
+        { return vector_ascii_prefix<32>(s); }
+        #endif
+    #endif
+#endif
+
+        /*
+         * Checks if every byte of s satisfies Kernel
+         * Strings shorter than a vector are checked by scalar code,
+         * AVX2 kernel is used for strings of at least 32 bytes if CPU supports it
+         */
+        template <typename Kernel>
+        [[nodiscard]] constexpr auto all_bytes_of(std::string_view s)
+            noexcept(Kernel::nothrow) -> bool
+        {
+            if consteval
+            {
+                return scalar_all_of<Kernel>(s);
+            }
+            else
+            {
+#if defined(CONSTRAINED_TYPE_VECTOR_KERNELS)
+                if constexpr (Kernel::vectorized)
+                {
+    #if defined(CONSTRAINED_TYPE_AVX2_DISPATCH)
+                    if (s.size() >= 32 and __builtin_cpu_supports("avx2"))
+                        return avx2_all_of<Kernel>(s);
+    #endif
+                    if (s.size() >= 16)
+                        return sse2_all_of<Kernel>(s);
+                }
+#endif
+                return scalar_all_of<Kernel>(s);
+            }
+        }
+
+        // Length of the longest prefix of s without bytes >= 0x80
+        [[nodiscard]] constexpr auto ascii_prefix(std::string_view s) noexcept -> std::size_t
+        {
+            if consteval
+            {
+                return scalar_ascii_prefix(s);
+            }
+            else
+            {
+#if defined(CONSTRAINED_TYPE_VECTOR_ASCII_PREFIX)
+    #if defined(CONSTRAINED_TYPE_AVX2_DISPATCH)
+                if (s.size() >= 32 and __builtin_cpu_supports("avx2"))
+                    return avx2_ascii_prefix(s);
+    #endif
+                if (s.size() >= 16)
+                    return sse2_ascii_prefix(s);
+#endif
+                return scalar_ascii_prefix(s);
+            }
+        }
+
+        struct ascii_kernel
+        {
+            using element = unsigned char;
+            static constexpr bool vectorized = true;
+            static constexpr bool nothrow = true;
+
+            [[nodiscard]] static constexpr auto scalar(char c) noexcept -> bool
+            { return static_cast<unsigned char>(c) < 0x80; }
+
+            template <typename Vec, typename Mask>
+            [[gnu::always_inline]] static void vector(Vec const & x, Mask & mask) noexcept
+            { mask = x < static_cast<unsigned char>(0x80); }
+        };
+
+        // Control characters are [0x00, 0x1F] and 0x7F, bytes >= 0x80 are allowed
+        struct no_control_kernel
+        {
+            using element = unsigned char;
+            static constexpr bool vectorized = true;
+            static constexpr bool nothrow = true;
+
+            [[nodiscard]] static constexpr auto scalar(char c) noexcept -> bool
+            {
+                auto const byte = static_cast<unsigned char>(c);
+                return byte >= 0x20 and byte != 0x7F;
+            }
+
+            template <typename Vec, typename Mask>
+            [[gnu::always_inline]] static void vector(Vec const & x, Mask & mask) noexcept
+            { mask = (x >= static_cast<unsigned char>(0x20)) & (x != static_cast<unsigned char>(0x7F)); }
+        };
+
+        struct byte_range
+        {
+            unsigned char first = 0;
+            unsigned char last = 0;
+        };
+
+        // Pattern errors are reported as compilation errors through failed constant evaluation
+        [[noreturn]] inline void charset_error(char const * message)
+        { throw std::invalid_argument{message}; }
+
+        /*
+         * Character set parsed from pattern like "a-zA-Z0-9_"
+         * '-' between two characters denotes inclusive range, otherwise it's a literal
+         */
+        template <fixed_string Pattern>
+        struct charset_table
+        {
+            static constexpr std::array<bool, 256> table = []{
+                std::array<bool, 256> result{};
+                auto const pattern = Pattern.view();
+                for (std::size_t i = 0; i < pattern.size(); ++i)
+                {
+                    auto first = static_cast<unsigned char>(pattern[i]);
+                    auto last = first;
+                    if (i + 2 < pattern.size() and pattern[i + 1] == '-')
+                    {
+                        last = static_cast<unsigned char>(pattern[i + 2]);
+                        if (last < first)
+                            charset_error("Invalid range in character set");
+                        i += 2;
+                    }
+                    for (unsigned c = first; c <= last; ++c)
+                        result[c] = true;
+                }
+                return result;
+            }();
+
+            static constexpr std::size_t range_count = []{
+                std::size_t count = 0;
+                for (std::size_t c = 0; c < table.size(); ++c)
+                    count += table[c] and (c == 0 or not table[c - 1]);
+                return count;
+            }();
+
+            // Maximal runs of table, e.g. "a-z_0-9" => [0-9], [_], [a-z]
+            static constexpr std::array<byte_range, range_count> ranges = []{
+                std::array<byte_range, range_count> result{};
+                std::size_t r = 0;
+                for (std::size_t c = 0; c < table.size(); ++c)
+                {
+                    if (not table[c])
+                        continue;
+                    if (c == 0 or not table[c - 1])
+                        result[r++].first = static_cast<unsigned char>(c);
+                    result[r - 1].last = static_cast<unsigned char>(c);
+                }
+                return result;
+            }();
+        };
+
+        /*
+         * Vector kernel checks every range with single unsigned comparison (x - first) <= (last - first)
+         * Sets with many ranges are checked with lookup table only
+         */
+        template <fixed_string Pattern>
+        struct charset_kernel
+        {
+            using set = charset_table<Pattern>;
+            using element = unsigned char;
+            static constexpr std::size_t max_vector_ranges = 8;
+            static constexpr bool vectorized = set::range_count > 0 and set::range_count <= max_vector_ranges;
+            static constexpr bool nothrow = true;
+
+            [[nodiscard]] static constexpr auto scalar(char c) noexcept -> bool
+            { return set::table[static_cast<unsigned char>(c)]; }
+
+            template <typename Vec, typename Mask>
+            [[gnu::always_inline]] static void vector(Vec const & x, Mask & mask) noexcept
+            {
+                [&x, &mask]<std::size_t... I>(std::index_sequence<I...>) {
+                    mask = Mask{};
+                    ((mask |= (x - set::ranges[I].first)
+                        <= static_cast<unsigned char>(set::ranges[I].last - set::ranges[I].first)), ...);
+                }(std::make_index_sequence<set::range_count>{});
+            }
+        };
+
+        /*
+         * Applies character predicate to every char
+         * Vectorized if predicate has SIMD lowering for char, e.g. and_<ge<'a'>, le<'z'>>
+         */
+        template <auto Pred>
+        struct char_predicate_kernel
+        {
+            using lowering = simd_lowering<std::remove_cv_t<decltype(Pred)>, char>;
+            using element = char;
+            static constexpr bool vectorized = lowering::value;
+            static constexpr bool nothrow = noexcept(static_cast<bool>(std::invoke(Pred, char{})));
+
+            [[nodiscard]] static constexpr auto scalar(char c) noexcept(nothrow) -> bool
+            { return static_cast<bool>(std::invoke(Pred, c)); }
+
+            template <typename Vec, typename Mask>
+            [[gnu::always_inline]] static void vector(Vec const & x, Mask & mask) noexcept
+            { lowering::eval(x, mask); }
+        };
+
+        /*
+         * Strict UTF-8 validation: overlong forms, surrogates and code points above U+10FFFF are rejected
+         * ASCII runs are skipped by vector kernels, multibyte sequences are checked by scalar code
+         * Pure ASCII strings are the common case and are checked without looking for run boundaries
+         */
+        [[nodiscard]] constexpr auto valid_utf8(std::string_view s) noexcept -> bool
+        {
+            if (all_bytes_of<ascii_kernel>(s))
+                return true;
+
+            auto const byte = [&s](std::size_t i) { return static_cast<unsigned char>(s[i]); };
+
+            std::size_t i = 0;
+            while (i < s.size())
+            {
+                if (byte(i) < 0x80)
+                {
+                    i += ascii_prefix(s.substr(i));
+                    continue;
+                }
+
+                auto const lead = byte(i);
+                std::size_t length = 0;
+                unsigned char first = 0x80;
+                unsigned char last = 0xBF;
+                if (lead < 0xC2)
+                    return false;
+                else if (lead < 0xE0)
+                    length = 2;
+                else if (lead < 0xF0)
+                {
+                    length = 3;
+                    if (lead == 0xE0)
+                        first = 0xA0;
+                    else if (lead == 0xED)
+                        last = 0x9F;
+                }
+                else if (lead < 0xF5)
+                {
+                    length = 4;
+                    if (lead == 0xF0)
+                        first = 0x90;
+                    else if (lead == 0xF4)
+                        last = 0x8F;
+                }
+                else
+                    return false;
+
+                if (s.size() - i < length)
+                    return false;
+                if (byte(i + 1) < first or byte(i + 1) > last)
+                    return false;
+                for (std::size_t k = 2; k < length; ++k)
+                {
+                    if ((byte(i + k) & 0xC0) != 0x80)
+                        return false;
+                }
+                i += length;
+            }
+            return true;
+        }
+    } // namespace detail::strings
+
+    namespace detail
+    {
+        template <std::size_t Min, std::size_t Max>
+            requires (Min <= Max)
+        struct [[nodiscard]] length_in final
+        {
+            using combinator_tag = void;
+            using view_checkable_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(string_like auto const & x) const noexcept -> bool
+            { return std::string_view{x}.size() - Min <= Max - Min; }
+        };
+
+        struct [[nodiscard]] ascii final
+        {
+            using combinator_tag = void;
+            using view_checkable_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(string_like auto const & x) const noexcept -> bool
+            { return strings::all_bytes_of<strings::ascii_kernel>(std::string_view{x}); }
+        };
+
+        struct [[nodiscard]] utf8_valid final
+        {
+            using combinator_tag = void;
+            using view_checkable_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(string_like auto const & x) const noexcept -> bool
+            { return strings::valid_utf8(std::string_view{x}); }
+        };
+
+        struct [[nodiscard]] no_control_chars final
+        {
+            using combinator_tag = void;
+            using view_checkable_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(string_like auto const & x) const noexcept -> bool
+            { return strings::all_bytes_of<strings::no_control_kernel>(std::string_view{x}); }
+        };
+
+        template <fixed_string Pattern>
+        struct [[nodiscard]] charset final
+        {
+            using combinator_tag = void;
+            using view_checkable_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(string_like auto const & x) const noexcept -> bool
+            { return strings::all_bytes_of<strings::charset_kernel<Pattern>>(std::string_view{x}); }
+        };
+
+        template <auto Pred>
+            requires std::predicate<decltype(Pred), char>
+        struct [[nodiscard]] all_of_chars final
+        {
+            using combinator_tag = void;
+            using view_checkable_tag = void;
+            using kernel = strings::char_predicate_kernel<Pred>;
+
+            [[nodiscard]] constexpr auto operator()(string_like auto const & x) const
+                noexcept(kernel::nothrow) -> bool
+            { return strings::all_bytes_of<kernel>(std::string_view{x}); }
+        };
+
+        template <fixed_string Prefix>
+        struct [[nodiscard]] starts_with final
+        {
+            using combinator_tag = void;
+            using view_checkable_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(string_like auto const & x) const noexcept -> bool
+            { return std::string_view{x}.starts_with(Prefix.view()); }
+        };
+
+        template <fixed_string Suffix>
+        struct [[nodiscard]] ends_with final
+        {
+            using combinator_tag = void;
+            using view_checkable_tag = void;
+
+            [[nodiscard]] constexpr auto operator()(string_like auto const & x) const noexcept -> bool
+            { return std::string_view{x}.ends_with(Suffix.view()); }
+        };
+    } // namespace detail
+
+    // Length is in [Min, Max]
+    CONSTRAINED_TYPE_TEMPLATED_COMBINATOR_CONSTANT(length_in);
+
+    // Every byte is below 0x80
+    CONSTRAINED_TYPE_COMBINATOR_CONSTANT(ascii);
+
+    // Well-formed UTF-8
+    CONSTRAINED_TYPE_COMBINATOR_CONSTANT(utf8_valid);
+
+    // No bytes in [0x00, 0x1F] and no 0x7F
+    CONSTRAINED_TYPE_COMBINATOR_CONSTANT(no_control_chars);
+
+    // Every byte is in set, e.g. charset<"a-zA-Z0-9_">
+    template <fixed_string Pattern>
+    inline constexpr auto charset = detail::charset<Pattern>{};
+
+    // Every char satisfies Pred, e.g. all_of_chars<or_<ge<'0'>, eq<'_'>>>
+    CONSTRAINED_TYPE_TEMPLATED_COMBINATOR_CONSTANT(all_of_chars);
+
+    template <fixed_string Prefix>
+    inline constexpr auto starts_with = detail::starts_with<Prefix>{};
+
+    template <fixed_string Suffix>
+    inline constexpr auto ends_with = detail::ends_with<Suffix>{};
+} // namespace ct
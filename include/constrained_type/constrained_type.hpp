@@ -1,12 +1,25 @@
 #pragma once
 
+#include <cassert>
 #include <stdexcept>
 #include <type_traits>
 #include <concepts>
 #include <optional>
 #include <functional>
+#include <expected>
+#include <array>
+#include <bit>
+#include <compare>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 
 #include <constrained_type/value_pack.hpp>
+#include <constrained_type/normalize.hpp>
+#include <constrained_type/interval.hpp>
+#include <constrained_type/instrumentation.hpp>
+#include <constrained_type/combinators/projection.hpp>
 
 namespace ct
 {
@@ -59,6 +72,12 @@ namespace ct
         dereferenceable<T>
         and noexcept(*std::declval<T>());
 
+    template <typename T, typename U>
+    concept equality_comparable_to = requires (T const & x, U const & y)
+    {
+        { x == y } -> std::convertible_to<bool>;
+    };
+
     template <typename T>
     concept member_accessible = requires (T x) { x.operator->(); };
 
@@ -82,6 +101,172 @@ namespace ct
         static constexpr value_type null = std::nullopt;
     };
 
+    /*
+     * Trait may declare check_view_type, a cheap view of value_type (e.g. std::string_view for std::string,
+     * std::span<U const> for std::vector<U>). Constraints accepting the view (see view_constraint) are checked
+     * on constructor argument before value_type is constructed from it, so rejected argument is never copied
+     * Such constraints must give the same result for the view and for the constructed value
+     */
+    template <typename Trait>
+    concept has_check_view =
+        constrained_trait<Trait>
+        and requires { typename Trait::check_view_type; };
+
+    /*
+     * Describes failed constraint
+     */
+    struct violation
+    {
+        // Index of the first failed constraint in constraint_pack
+        std::size_t index = 0;
+
+        constexpr auto operator==(violation const &) const noexcept -> bool = default;
+    };
+
+    /*
+     * Controls when constructors check constraints
+     * always     - on every construction
+     * debug_only - only if NDEBUG is not defined
+     * sampled    - on every sample_rate-th construction of the type in each thread
+     * lazy       - on the first access to the value or on validate_all()
+     * Checks are always performed in constant evaluation
+     */
+    enum class check_policy
+    {
+        always,
+        debug_only,
+        sampled,
+        lazy,
+    };
+
+#ifdef NDEBUG
+    inline constexpr bool debug_build = false;
+#else
+    inline constexpr bool debug_build = true;
+#endif
+
+    /*
+     * Tag for constructor, which skips checks for values from trusted sources
+     * Constraints are still asserted in debug builds
+     */
+    struct trusted_t
+    {
+        explicit trusted_t() = default;
+    };
+
+    inline constexpr trusted_t trusted{};
+
+    namespace detail
+    {
+        // Invocability is known without instantiating the body: function or non-template call operator
+        template <typename F>
+        concept exactly_invocable =
+            std::is_function_v<std::remove_pointer_t<F>>
+            or requires { &F::operator(); };
+    }
+
+    /*
+     * Constraint checked on View: callable with it and either opted in by view_checkable_tag
+     * or having non-template call operator. Generic callables, e.g. gt<&std::string::length, 3>,
+     * are checked on the value, because they may accept the view and still fail to compile with it
+     */
+    template <typename Constraint, typename View>
+    concept view_constraint =
+        (view_checkable_combinator<Constraint> or detail::exactly_invocable<Constraint>)
+        and std::predicate<Constraint const &, View const &>;
+
+    namespace detail
+    {
+        /*
+         * Splits ConstraintPack into constraints checked on Trait::check_view_type and on value_type,
+         * keeping their order
+         */
+        template <typename Trait, typename ConstraintPack>
+        struct view_constraints
+        {
+            using on_view = value_pack<>;
+            using on_value = ConstraintPack;
+        };
+
+        template <has_check_view Trait, auto... Constraints>
+        struct view_constraints<Trait, value_pack<Constraints...>>
+        {
+            using view_type = typename Trait::check_view_type;
+
+            using on_view = typename concat_packs<std::conditional_t<
+                view_constraint<std::remove_cv_t<decltype(Constraints)>, view_type>,
+                value_pack<Constraints>,
+                value_pack<>
+            >...>::type;
+
+            using on_value = typename concat_packs<std::conditional_t<
+                view_constraint<std::remove_cv_t<decltype(Constraints)>, view_type>,
+                value_pack<>,
+                value_pack<Constraints>
+            >...>::type;
+        };
+
+        // Args is a single argument viewable as Trait::check_view_type and some of constraints accept the view
+        template <typename Trait, typename ConstraintPack, typename... Args>
+        inline constexpr bool checks_view = false;
+
+        template <has_check_view Trait, typename ConstraintPack, typename Arg>
+        inline constexpr bool checks_view<Trait, ConstraintPack, Arg> =
+            std::convertible_to<Arg const &, typename Trait::check_view_type>
+            and view_constraints<Trait, ConstraintPack>::on_view::size > 0;
+
+        template <typename ConstrainedType>
+        struct sample_counter
+        {
+            static inline thread_local std::uint32_t countdown = 1;
+        };
+
+        // Returns true on every Rate-th call in current thread
+        template <typename ConstrainedType, std::uint32_t Rate>
+        [[nodiscard]] inline auto sample() noexcept -> bool
+        {
+            auto & countdown = sample_counter<ConstrainedType>::countdown;
+            if (--countdown != 0)
+                return false;
+            countdown = Rate;
+            return true;
+        }
+
+        /*
+         * Deferred validation state of lazy constrained type
+         * Empty for other policies, so it takes no space
+         */
+        template <bool Lazy>
+        struct lazy_state {};
+
+        /*
+         * Const lazy value may be validated by several threads on the first access, so flags are accessed atomically
+         * Validation is idempotent, concurrent validations store the same flags
+         * std::atomic_ref keeps the state (and lazy constrained type) trivially copyable
+         */
+        template <>
+        struct lazy_state<true>
+        {
+            static constexpr std::uint8_t validated = 1;
+            static constexpr std::uint8_t failed = 2;
+
+            [[nodiscard]] constexpr auto load() const noexcept -> std::uint8_t
+            {
+                if consteval { return _flags; }
+                else { return std::atomic_ref{_flags}.load(std::memory_order_acquire); }
+            }
+
+            constexpr void store(std::uint8_t flags) const noexcept
+            {
+                if consteval { _flags = flags; }
+                else { std::atomic_ref{_flags}.store(flags, std::memory_order_release); }
+            }
+
+        private:
+            alignas(std::atomic_ref<std::uint8_t>::required_alignment) mutable std::uint8_t _flags = 0;
+        };
+    }
+
     struct configuration_point
     {
         bool explicit_bool = true;
@@ -89,8 +274,23 @@ namespace ct
         bool opaque_dereferencable = true;
         bool opaque_member_accessible = true;
         bool opaque_pointer_accessible = true;
+        bool branchless_checks = false;
+        bool normalize_constraints = false;
+        ct::check_policy check_policy = ct::check_policy::always;
+        std::uint32_t sample_rate = 64;
+        bool instrumented = false;
+        std::uint32_t cycle_sample_rate = 0;
     };
 
+    namespace detail
+    {
+        // Forwarding constructor checks view of its argument, checks of other policies are deferred or skipped
+        template <typename T, typename Trait, configuration_point Config, typename ConstraintPack, typename... Args>
+        inline constexpr bool constructs_from_view =
+            (Config.check_policy == check_policy::always or (Config.check_policy == check_policy::debug_only and debug_build))
+            and checks_view<Trait, typename maybe_normalize<Config.normalize_constraints, T, ConstraintPack>::type, Args...>;
+    }
+
     template <typename T, constrained_trait Trait, configuration_point Config, auto... Constraints>
         requires (std::predicate<decltype(Constraints), T const &> && ...)
             and std::same_as<T, typename Trait::value_type>
@@ -106,12 +306,82 @@ namespace ct
         consteval auto is_constrained(auto*) -> std::false_type;
     }
 
+    namespace detail
+    {
+        /*
+         * Every value of constrained type with Config satisfies its constraints when it is read
+         * Sampled values and debug_only values in release builds may have never been checked
+         */
+        [[nodiscard]] constexpr auto checks_every_value(configuration_point const & config) noexcept -> bool
+        {
+            switch (config.check_policy)
+            {
+            case check_policy::always:
+            case check_policy::lazy:
+                return true;
+            case check_policy::debug_only:
+                return debug_build;
+            default:
+                return false;
+            }
+        }
+
+        /*
+         * Non-null value of constrained type with OtherConstraints satisfies ConstraintPack
+         * if every constraint of ConstraintPack is in OtherConstraints or is implied by their interval
+         * and OtherConfig checks every value
+         */
+        template <typename T, typename ConstraintPack, constrained_trait OtherTrait, configuration_point OtherConfig, auto... OtherConstraints>
+        inline constexpr bool is_covered_by =
+            unchecked_constraints<T, ConstraintPack, OtherConstraints...>::type::size == 0
+            and not nullable<OtherTrait>
+            and checks_every_value(OtherConfig);
+    }
+
     template <typename T>
     concept constrained = std::same_as<
         decltype(detail::is_constrained(static_cast<T*>(nullptr))),
         std::true_type
     >;
 
+    template <constrained ConstrainedType>
+    class optional;
+
+    template <constrained ConstrainedType>
+        requires std::is_trivially_copyable_v<typename ConstrainedType::value_type>
+    class atomic;
+
+    namespace detail
+    {
+        struct raw_access;
+        struct covered_access;
+        struct constant_access;
+
+        /*
+         * Instantiated with the index of the first failed constraint, so compiler diagnostic shows
+         * the constant and the constraint instead of a throw in constant expression
+         */
+        template <typename ConstrainedType, auto Value, std::size_t FailedConstraint>
+        struct constant_check
+        {
+            static_assert(
+                FailedConstraint == ConstrainedType::constraint_pack::size,
+                "Constant Value doesn't satisfy constraint number FailedConstraint of ConstrainedType"
+            );
+            static constexpr bool value = true;
+        };
+
+        template <typename ConstrainedType, std::size_t Element, std::size_t FailedConstraint>
+        struct table_check
+        {
+            static_assert(
+                FailedConstraint == ConstrainedType::constraint_pack::size,
+                "Element number Element of static table doesn't satisfy constraint number FailedConstraint of ConstrainedType"
+            );
+            static constexpr bool value = true;
+        };
+    }
+
     namespace detail
     {
         template <constrained ConstrainedType, auto... Constraints>
@@ -154,6 +424,15 @@ namespace ct
         ConstrainedType::config_value
     >;
 
+    template <constrained ConstrainedType>
+    using normalize_constraints = set_constraint_pack<
+        ConstrainedType,
+        normalize_constraint_pack<
+            typename ConstrainedType::value_type,
+            typename ConstrainedType::constraint_pack
+        >
+    >;
+
     template <typename T, constrained_trait Trait, configuration_point Config, auto... Constraints>
         requires (std::predicate<decltype(Constraints), T const &> && ...)
             and std::same_as<T, typename Trait::value_type>
@@ -180,6 +459,8 @@ namespace ct
         using add_constraints = ct::add_constraints<self_type, AdditionalConstraints...>;
 
         using clear_constraints = ct::clear_constraints<self_type>;
+
+        using normalize_constraints = ct::normalize_constraints<self_type>;
 #pragma endregion type_manipulations
 
 #pragma region constructors
@@ -197,121 +478,655 @@ namespace ct
             and noexcept(check())
         )
             requires std::is_constructible_v<T, Args...>
+                and (not detail::constructs_from_view<T, Trait, Config, value_pack<Constraints...>, Args...>)
             : _value{std::forward<Args>(args)...}
         { check(); }
 
-        basic_constrained_type(basic_constrained_type const & other) noexcept(std::is_nothrow_copy_constructible_v<T>)
-            requires std::is_copy_constructible_v<T>
-            : _value{other._value}
-        {}
-
-        constexpr basic_constrained_type(basic_constrained_type && other) noexcept(std::is_nothrow_move_constructible_v<T>)
-            requires std::is_move_constructible_v<T>
-            : _value{std::move(other._value)}
+        /*
+         * Constraints accepting Trait::check_view_type are checked on the argument before T is constructed
+         * Rejected argument isn't copied: value is constructed as Trait::null or exception is thrown
+         */
+        template <typename Arg>
+        constexpr explicit(Config.explicit_forwarding_constructor) basic_constrained_type(Arg && arg) noexcept(
+            std::is_nothrow_constructible_v<T, Arg>
+            and nothrow_null_constructible<Trait>
+            and noexcept(run_checks(view_of(arg), typename view_split<constraint_pack>::on_view{}))
+            and noexcept(std::declval<basic_constrained_type &>().evaluate(typename view_split<constraint_pack>::on_value{}))
+        )
+            requires std::is_constructible_v<T, Arg>
+                and detail::constructs_from_view<T, Trait, Config, value_pack<Constraints...>, Arg>
+            : basic_constrained_type{
+                view_checked_tag{},
+                run_checks(view_of(arg), typename view_split<constraint_pack>::on_view{}) == constraint_pack::size,
+                std::forward<Arg>(arg)
+            }
         {}
-#pragma endregion constructors
 
-#pragma region assignments
-        constexpr auto operator=(basic_constrained_type const & other)
-            noexcept(std::is_nothrow_copy_constructible_v<T>)
-            -> basic_constrained_type &
-            requires std::is_copy_constructible_v<T>
+        /*
+         * Skips checks for values known to satisfy constraints (e.g. read from own validated cache)
+         * Constraints are asserted in debug builds
+         */
+        template <typename... Args>
+        constexpr basic_constrained_type(trusted_t, Args&&... args) noexcept(
+            std::is_nothrow_constructible_v<T, Args...>
+            and (not debug_build or noexcept(find_violation(checked_pack<constraint_pack>{})))
+        )
+            requires std::is_constructible_v<T, Args...>
+            : _value{std::forward<Args>(args)...}
         {
-            _value = other._value;
-            return *this;
+            record_construction();
+            if constexpr (debug_build)
+                assert(find_violation(checked_pack<constraint_pack>{}) == constraint_pack::size && "Trusted value doesn't satisfy constraints");
+            mark_validated();
         }
 
-        constexpr auto operator=(basic_constrained_type && other)
-            noexcept(std::is_nothrow_move_constructible_v<T>)
-            -> basic_constrained_type &
-            requires std::is_move_constructible_v<T>
+        /*
+         * Converts from constrained type with the same T
+         * Constraints already satisfied by other are not checked again
+         * Conversion is implicit and doesn't check anything if other's constraints cover ours
+         */
+        template <constrained_trait OtherTrait, configuration_point OtherConfig, auto... OtherConstraints>
+            requires (not std::same_as<basic_constrained_type<T, OtherTrait, OtherConfig, OtherConstraints...>, self_type>)
+                and std::is_copy_constructible_v<T>
+        constexpr explicit(
+            not detail::is_covered_by<T, constraint_pack, OtherTrait, OtherConfig, OtherConstraints...>
+            and Config.explicit_forwarding_constructor
+        ) basic_constrained_type(basic_constrained_type<T, OtherTrait, OtherConfig, OtherConstraints...> const & other) noexcept(
+            std::is_nothrow_copy_constructible_v<T>
+            and noexcept(other.access())
+            and noexcept(check_converted<OtherTrait, OtherConfig, OtherConstraints...>())
+        )
+            : _value{other.access()}
+        { check_converted<OtherTrait, OtherConfig, OtherConstraints...>(); }
+
+        template <constrained_trait OtherTrait, configuration_point OtherConfig, auto... OtherConstraints>
+            requires (not std::same_as<basic_constrained_type<T, OtherTrait, OtherConfig, OtherConstraints...>, self_type>)
+                and std::is_move_constructible_v<T>
+        constexpr explicit(
+            not detail::is_covered_by<T, constraint_pack, OtherTrait, OtherConfig, OtherConstraints...>
+            and Config.explicit_forwarding_constructor
+        ) basic_constrained_type(basic_constrained_type<T, OtherTrait, OtherConfig, OtherConstraints...> && other) noexcept(
+            std::is_nothrow_move_constructible_v<T>
+            and noexcept(other.access())
+            and noexcept(check_converted<OtherTrait, OtherConfig, OtherConstraints...>())
+        )
+            : _value{std::move(other.access())}
+        { check_converted<OtherTrait, OtherConfig, OtherConstraints...>(); }
+
+        /*
+         * Constructs value and reports the first failed constraint instead of failing
+         * Never throws on failed constraints, even if Trait is not nullable
+         */
+        template <typename... Args>
+        [[nodiscard]] static constexpr auto try_make(Args&&... args) noexcept(
+            std::is_nothrow_constructible_v<T, Args...>
+            and std::is_nothrow_move_constructible_v<T>
+            and noexcept(std::declval<basic_constrained_type const &>().run_checks(checked_pack<constraint_pack>{}))
+            and nothrow_view_check<constraint_pack, Args...>()
+        ) -> std::expected<basic_constrained_type, violation>
+            requires std::is_constructible_v<T, Args...>
+        { return try_make_checking<constraint_pack>(std::forward<Args>(args)...); }
+
+        /*
+         * Validates constant at compile time, failed constraint is reported by static_assert
+         * Nothing is checked at runtime, so the constant costs no more than T
+         */
+        template <auto Value>
+            requires std::is_constructible_v<T, decltype(Value) const &>
+        [[nodiscard]] static consteval auto from_constant() -> basic_constrained_type
         {
-            _value = std::move(other._value);
-            return *this;
+            static_assert(detail::constant_check<basic_constrained_type, Value, constant_violation(Value)>::value);
+            return make_constant(Value);
         }
+
+        // Defaulted special members keep T's triviality, so trivially copyable T is passed in registers
+        constexpr basic_constrained_type(basic_constrained_type const &) = default;
+        constexpr basic_constrained_type(basic_constrained_type &&) = default;
+#pragma endregion constructors
+
+#pragma region assignments
+        constexpr auto operator=(basic_constrained_type const &) -> basic_constrained_type & = default;
+        constexpr auto operator=(basic_constrained_type &&) -> basic_constrained_type & = default;
 #pragma endregion
 
         [[nodiscard]] constexpr explicit(Config.explicit_bool) operator bool() const noexcept(
             noexcept(static_cast<bool>(_value != Trait::null))
+            and noexcept(access())
         )
             requires nullable<Trait>
         {
-            return static_cast<bool>(_value != Trait::null);
+            return static_cast<bool>(access() != Trait::null);
+        }
+
+        /*
+         * Runs deferred checks of lazy type
+         * Other policies check in constructors, so this does nothing for them
+         */
+        constexpr void validate_all() const noexcept(noexcept(validate_lazily()))
+        {
+            if !consteval { validate_lazily(); }
         }
 
 #pragma region dereference_operators
-        [[nodiscard]] constexpr decltype(auto) operator*() const & noexcept(nothrow_dereferenceable<T>)
+        [[nodiscard]] constexpr decltype(auto) operator*() const & noexcept(nothrow_dereferenceable<T> and noexcept(access()))
             requires dereferenceable<T> and (Config.opaque_dereferencable)
-        { return *_value; }
+        { return *access(); }
 
-        [[nodiscard]] constexpr decltype(auto) operator*() && noexcept(nothrow_dereferenceable<T>)
+        [[nodiscard]] constexpr decltype(auto) operator*() && noexcept(nothrow_dereferenceable<T> and noexcept(access()))
             requires dereferenceable<T> and (Config.opaque_dereferencable)
-        { return *std::move(_value); }
+        { return *std::move(access()); }
 
-        [[nodiscard]] constexpr decltype(auto) operator*() const && noexcept(nothrow_dereferenceable<T>)
+        [[nodiscard]] constexpr decltype(auto) operator*() const && noexcept(nothrow_dereferenceable<T> and noexcept(access()))
             requires dereferenceable<T> and (Config.opaque_dereferencable)
-        { return *std::move(_value); }
+        { return *std::move(access()); }
 
-        [[nodiscard]] constexpr auto operator*() const & noexcept -> const T&
-        { return _value; }
+        [[nodiscard]] constexpr auto operator*() const & noexcept(noexcept(access())) -> const T&
+        { return access(); }
 
-        [[nodiscard]] constexpr auto operator*() && noexcept -> T&&
-        { return std::move(_value); }
+        [[nodiscard]] constexpr auto operator*() && noexcept(noexcept(access())) -> T&&
+        { return std::move(access()); }
 
-        [[nodiscard]] constexpr auto operator*() const && noexcept -> const T&&
-        { return std::move(_value); }
+        [[nodiscard]] constexpr auto operator*() const && noexcept(noexcept(access())) -> const T&&
+        { return std::move(access()); }
 #pragma endregion dereference_operators
 
 #pragma region access_operators
         // Member accessible overloads
-        [[nodiscard]] constexpr decltype(auto) operator->() const & noexcept(nothrow_member_accessible<T>)
+        [[nodiscard]] constexpr decltype(auto) operator->() const & noexcept(nothrow_member_accessible<T> and noexcept(access()))
             requires member_accessible<T> and (Config.opaque_member_accessible)
-        { return _value.operator->(); }
+        { return access().operator->(); }
 
-        [[nodiscard]] constexpr decltype(auto) operator->() && noexcept(nothrow_member_accessible<T>)
+        [[nodiscard]] constexpr decltype(auto) operator->() && noexcept(nothrow_member_accessible<T> and noexcept(access()))
             requires member_accessible<T> and (Config.opaque_member_accessible)
-        { return std::move(_value).operator->(); }
+        { return std::move(access()).operator->(); }
 
-        [[nodiscard]] constexpr decltype(auto) operator->() const && noexcept(nothrow_member_accessible<T>)
+        [[nodiscard]] constexpr decltype(auto) operator->() const && noexcept(nothrow_member_accessible<T> and noexcept(access()))
             requires member_accessible<T> and (Config.opaque_member_accessible)
-        { return std::move(_value).operator->(); }
+        { return std::move(access()).operator->(); }
 
         // Pointer overloads
-        [[nodiscard]] constexpr decltype(auto) operator->() const & noexcept
+        [[nodiscard]] constexpr decltype(auto) operator->() const & noexcept(noexcept(access()))
             requires std::is_pointer_v<T> and (Config.opaque_pointer_accessible)
-        { return _value; }
+        { return access(); }
 
-        [[nodiscard]] constexpr decltype(auto) operator->() && noexcept
+        [[nodiscard]] constexpr decltype(auto) operator->() && noexcept(noexcept(access()))
             requires std::is_pointer_v<T> and (Config.opaque_pointer_accessible)
-        { return std::move(_value); }
+        { return std::move(access()); }
 
-        [[nodiscard]] constexpr decltype(auto) operator->() const && noexcept
+        [[nodiscard]] constexpr decltype(auto) operator->() const && noexcept(noexcept(access()))
             requires std::is_pointer_v<T> and (Config.opaque_pointer_accessible)
-        { return std::move(_value); }
+        { return std::move(access()); }
 
         // Fallback overloads
-        [[nodiscard]] constexpr auto operator->() const & noexcept -> const T*
-        { return &_value; }
+        [[nodiscard]] constexpr auto operator->() const & noexcept(noexcept(access())) -> const T*
+        { return &access(); }
 
-        [[nodiscard]] constexpr auto operator->() && noexcept -> T*
-        { return &_value; }
+        [[nodiscard]] constexpr auto operator->() && noexcept(noexcept(access())) -> T*
+        { return &access(); }
 
-        [[nodiscard]] constexpr auto operator->() const && noexcept -> const T*
-        { return &_value; }
+        [[nodiscard]] constexpr auto operator->() const && noexcept(noexcept(access())) -> const T*
+        { return &access(); }
 #pragma endregion access_operators
-    
+
+#pragma region comparison_operators
+        /*
+         * Comparisons are forwarded to T
+         * Raw values (e.g. std::string_view for std::string) are compared without constructing constrained type
+         */
+        [[nodiscard]] friend constexpr auto operator==(basic_constrained_type const & x, basic_constrained_type const & y) noexcept(
+            noexcept(static_cast<bool>(x.access() == y.access()))
+        ) -> bool
+            requires equality_comparable_to<T, T>
+        { return static_cast<bool>(x.access() == y.access()); }
+
+        // Self is deduced, so the operator isn't considered for other types found by ADL (e.g. container iterators)
+        template <std::same_as<basic_constrained_type> Self, typename U>
+            requires (not constrained<U>) and equality_comparable_to<T, U>
+        [[nodiscard]] friend constexpr auto operator==(Self const & x, U const & y) noexcept(
+            noexcept(static_cast<bool>(x.access() == y))
+        ) -> bool
+        { return static_cast<bool>(x.access() == y); }
+
+        [[nodiscard]] friend constexpr auto operator<=>(basic_constrained_type const & x, basic_constrained_type const & y) noexcept(
+            noexcept(x.access() <=> y.access())
+        )
+            requires std::three_way_comparable<T>
+        { return x.access() <=> y.access(); }
+
+        template <std::same_as<basic_constrained_type> Self, typename U>
+            requires (not constrained<U>) and std::three_way_comparable_with<T, U>
+        [[nodiscard]] friend constexpr auto operator<=>(Self const & x, U const & y) noexcept(
+            noexcept(x.access() <=> y)
+        ) -> std::compare_three_way_result_t<T, U>
+        { return x.access() <=> y; }
+#pragma endregion comparison_operators
+
     private:
+        static constexpr bool is_lazy = Config.check_policy == check_policy::lazy;
+
         T _value;
+        [[no_unique_address]] detail::lazy_state<is_lazy> _state;
+
+        struct unchecked_tag {};
+
+        template <typename... Args>
+        constexpr basic_constrained_type(unchecked_tag, Args&&... args) noexcept(
+            std::is_nothrow_constructible_v<T, Args...>
+        )
+            : _value{std::forward<Args>(args)...}
+        {}
+
+        struct view_checked_tag {};
+
+        // Constructs value from argument if its view passed checks, the rest of constraints is checked on the value
+        template <typename Arg>
+        constexpr basic_constrained_type(view_checked_tag, bool view_satisfied, Arg && arg) noexcept(
+            std::is_nothrow_constructible_v<T, Arg>
+            and nothrow_null_constructible<Trait>
+            and noexcept(evaluate(typename view_split<constraint_pack>::on_value{}))
+        )
+            : _value{view_satisfied ? T(std::forward<Arg>(arg)) : rejected()}
+        {
+            record_construction();
+            if (view_satisfied)
+                evaluate(typename view_split<constraint_pack>::on_value{});
+        }
+
+        [[nodiscard]] static constexpr auto view_of(auto const & arg) noexcept(
+            std::is_nothrow_convertible_v<decltype(arg), typename Trait::check_view_type>
+        )
+        {
+            typename Trait::check_view_type const view = arg;
+            return view;
+        }
+
+        template <typename CheckedPack, typename... Args>
+        [[nodiscard]] static consteval auto nothrow_view_check() -> bool
+        {
+            if constexpr (detail::checks_view<Trait, checked_pack<CheckedPack>, Args...>)
+                return noexcept(run_checks(view_of(std::declval<Args const &>()...), typename view_split<CheckedPack>::on_view{}));
+            else
+                return true;
+        }
+
+        // Value constructed instead of rejected argument
+        [[nodiscard]] static constexpr auto rejected() noexcept(nothrow_null_constructible<Trait>) -> T
+        {
+            if constexpr (nullable<Trait>)
+                return Trait::null;
+            else
+                throw std::logic_error{"Constraints not satisfied"};
+        }
+
+        template <typename U, constrained_trait UTrait, configuration_point UConfig, auto... UConstraints>
+            requires (std::predicate<decltype(UConstraints), U const &> && ...)
+                and std::same_as<U, typename UTrait::value_type>
+        friend class basic_constrained_type;
+
+        // Stores empty state as a value violating constraints
+        template <constrained ConstrainedType>
+        friend class optional;
+
+        // Stores raw value and publishes only validated values
+        template <constrained ConstrainedType>
+            requires std::is_trivially_copyable_v<typename ConstrainedType::value_type>
+        friend class atomic;
+
+        friend struct detail::raw_access;
+        friend struct detail::covered_access;
+        friend struct detail::constant_access;
+
+        constexpr void check() noexcept(noexcept(check(constraint_pack{})))
+        { check(constraint_pack{}); }
+
+        // Index of the first constraint failed by value in constant evaluation
+        [[nodiscard]] static constexpr auto constant_violation(auto const & value) -> std::size_t
+        { return basic_constrained_type{unchecked_tag{}, value}.find_violation(checked_pack<constraint_pack>{}); }
+
+        [[nodiscard]] static constexpr auto make_constant(auto const & value) -> basic_constrained_type
+        {
+            basic_constrained_type result{unchecked_tag{}, value};
+            result.mark_validated();
+            return result;
+        }
+
+        // try_make checking only the given subset of constraints, the rest is known to be satisfied
+        template <typename CheckedPack, typename... Args>
+        [[nodiscard]] static constexpr auto try_make_checking(Args&&... args) noexcept(
+            std::is_nothrow_constructible_v<T, Args...>
+            and std::is_nothrow_move_constructible_v<T>
+            and noexcept(std::declval<basic_constrained_type const &>().run_checks(checked_pack<CheckedPack>{}))
+            and nothrow_view_check<CheckedPack, Args...>()
+        ) -> std::expected<basic_constrained_type, violation>
+        {
+            if constexpr (detail::checks_view<Trait, checked_pack<CheckedPack>, Args...>)
+            {
+                auto const view_index = run_checks(view_of(args...), typename view_split<CheckedPack>::on_view{});
+                if (view_index == constraint_pack::size)
+                {
+                    basic_constrained_type result{unchecked_tag{}, std::forward<Args>(args)...};
+                    result.record_construction();
+                    auto const index = result.run_checks(typename view_split<CheckedPack>::on_value{});
+                    if (index != constraint_pack::size)
+                        return std::unexpected{violation{index}};
+                    result.mark_validated();
+                    return std::expected<basic_constrained_type, violation>{std::move(result)};
+                }
+                // Only constraints checked on value and preceding the failed one may report an earlier violation
+                using on_value = typename view_split<CheckedPack>::on_value;
+                if (view_index < first_index(on_value{}))
+                {
+                    record_construction();
+                    return std::unexpected{violation{view_index}};
+                }
+                if constexpr (on_value::size > 0)
+                {
+                    basic_constrained_type const result{unchecked_tag{}, std::forward<Args>(args)...};
+                    result.record_construction();
+                    return std::unexpected{violation{result.run_checks_before(on_value{}, view_index)}};
+                }
+            }
+
+            basic_constrained_type result{unchecked_tag{}, std::forward<Args>(args)...};
+            result.record_construction();
+            auto const index = result.run_checks(checked_pack<CheckedPack>{});
+            if (index != constraint_pack::size)
+                return std::unexpected{violation{index}};
+            result.mark_validated();
+            return std::expected<basic_constrained_type, violation>{std::move(result)};
+        }
+
+        template <typename ConstraintPack>
+        using checked_pack = typename detail::maybe_normalize<
+            Config.normalize_constraints, T, ConstraintPack
+        >::type;
+
+        // Checked constraints accepting Trait::check_view_type and the rest
+        template <typename CheckedPack>
+        using view_split = detail::view_constraints<Trait, checked_pack<CheckedPack>>;
+
+        // Checks only the given subset of constraints according to check_policy
+        template <auto... Checked>
+        constexpr void check(value_pack<Checked...>) noexcept(
+            noexcept(evaluate(checked_pack<value_pack<Checked...>>{}))
+        )
+        {
+            record_construction();
+            if constexpr (Config.check_policy == check_policy::debug_only and not debug_build)
+            {
+                if consteval { evaluate(checked_pack<value_pack<Checked...>>{}); }
+            }
+            else if constexpr (is_lazy)
+            {
+                if consteval
+                {
+                    evaluate(checked_pack<value_pack<Checked...>>{});
+                    mark_validated();
+                }
+            }
+            else if constexpr (Config.check_policy == check_policy::sampled)
+            {
+                static_assert(Config.sample_rate > 0, "sample_rate must be positive");
+                if consteval { evaluate(checked_pack<value_pack<Checked...>>{}); }
+                else
+                {
+                    if (detail::sample<self_type, Config.sample_rate>())
+                        evaluate(checked_pack<value_pack<Checked...>>{});
+                }
+            }
+            else
+                evaluate(checked_pack<value_pack<Checked...>>{});
+        }
+
+        template <auto... Checked>
+        constexpr void evaluate(value_pack<Checked...>) noexcept(
+            sizeof...(Checked) == 0
+            or (noexcept(run_checks(value_pack<Checked...>{})) and noexcept(fail()))
+        )
+        {
+            if constexpr (sizeof...(Checked) == 0)
+                return;
+            else
+            {
+                bool const satisfied = run_checks(value_pack<Checked...>{}) == constraint_pack::size;
+                if constexpr (Config.branchless_checks and nullable<Trait> and std::is_trivially_copyable_v<T>)
+                    _value = satisfied ? _value : Trait::null;
+                else if (!satisfied)
+                {
+                    fail();
+                }
+            }
+        }
+
+        /*
+         * Returns index of the first failed constraint in constraint_pack or constraint_pack::size
+         * Index is a by-product of the fold, so no predicate is evaluated twice
+         * Projection shared by several constraints (e.g. gt<&std::string::length, 10> and lt<&std::string::length, 20>)
+         * is computed once
+         */
+        template <auto... Checked>
+        [[nodiscard]] constexpr auto find_violation(value_pack<Checked...> pack) const noexcept(
+            noexcept(find_violation(_value, pack))
+        ) -> std::size_t
+        { return find_violation(_value, pack); }
+
+        // Checks value or its view
+        template <typename U, auto... Checked>
+        [[nodiscard]] static constexpr auto find_violation(U const & value, value_pack<Checked...>) noexcept(
+            (nothrow_predicate<decltype(Checked), U const &> && ...)
+        ) -> std::size_t
+        {
+            constexpr std::array<std::size_t, sizeof...(Checked) + 1> original_index{
+                constraint_pack::template index_of<Checked>..., constraint_pack::size
+            };
+
+            projection_cache<U, value_pack<Checked...>> projections{value};
+            std::size_t passed = 0;
+            if constexpr (Config.branchless_checks)
+            {
+                // Cheap constraints are evaluated even after failure, so there is no branch per constraint to mispredict
+                // Others are evaluated only while every previous constraint is satisfied
+                bool satisfied = true;
+                ((satisfied = check_in_order<Checked>(projections, satisfied), passed += satisfied), ...);
+            }
+            else
+            {
+                static_cast<void>((
+                    (projections.template check<Checked>() ? (++passed, true) : false) && ...
+                ));
+            }
+            return original_index[passed];
+        }
+
+        // Result of constraint C and every previous constraint, given result of previous ones
+        template <auto C, typename Projections>
+        [[nodiscard]] static constexpr auto check_in_order(Projections & projections, bool satisfied) noexcept(
+            noexcept(projections.template check<C>())
+        ) -> bool
+        {
+            if constexpr (cheap_combinator<std::remove_cv_t<decltype(C)>>)
+                return satisfied & projections.template check<C>();
+            else
+                return satisfied and projections.template check<C>();
+        }
+
+        // Checked constraints are in constraint_pack order, so evaluation stops at the first one not preceding limit
+        template <typename U, auto... Checked>
+        [[nodiscard]] static constexpr auto find_violation_before(U const & value, value_pack<Checked...>, std::size_t limit) noexcept(
+            (nothrow_predicate<decltype(Checked), U const &> && ...)
+        ) -> std::size_t
+        {
+            projection_cache<U, value_pack<Checked...>> projections{value};
+            std::size_t result = limit;
+            static_cast<void>((
+                (
+                    constraint_pack::template index_of<Checked> < limit
+                    and (projections.template check<Checked>() or (result = constraint_pack::template index_of<Checked>, false))
+                ) && ...
+            ));
+            return result;
+        }
+
+        // Index of the first constraint of pack in constraint_pack, constraint_pack::size for empty pack
+        template <auto... Checked>
+        [[nodiscard]] static consteval auto first_index(value_pack<Checked...>) noexcept -> std::size_t
+        {
+            std::size_t result = constraint_pack::size;
+            ((result = constraint_pack::template index_of<Checked> < result ? constraint_pack::template index_of<Checked> : result), ...);
+            return result;
+        }
+
+        constexpr void mark_validated() noexcept
+        {
+            if constexpr (is_lazy)
+                _state.store(detail::lazy_state<true>::validated);
+        }
 
-        constexpr void check() noexcept(
-            (nothrow_predicate<decltype(Constraints), T const &> && ...)
-            and noexcept(fail())
+        /*
+         * Checks lazy value once
+         * Failed nullable value is marked and read as Trait::null, non-nullable fails on every access
+         */
+        constexpr void validate_lazily() const noexcept(
+            not is_lazy
+            or (noexcept(run_checks(checked_pack<constraint_pack>{})) and nullable<Trait>)
         )
         {
-            bool satisfied = (std::invoke(Constraints, _value) && ...);
-            if (!satisfied)
+            if constexpr (is_lazy)
             {
-                fail();
+                using state = detail::lazy_state<true>;
+                if (_state.load() & state::validated)
+                    return;
+                if (run_checks(checked_pack<constraint_pack>{}) != constraint_pack::size)
+                {
+                    if constexpr (nullable<Trait>)
+                        _state.store(state::validated | state::failed);
+                    else
+                        fail();
+                }
+                else
+                {
+                    _state.store(state::validated);
+                }
+            }
+        }
+
+        /*
+         * Every read of the value goes through access(), so lazy type is checked before the first read
+         * Lazy checks are never deferred in constant evaluation
+         */
+        [[nodiscard]] constexpr auto access() const & noexcept(noexcept(validate_lazily())) -> T const &
+        {
+            if constexpr (is_lazy)
+            {
+                if !consteval
+                {
+                    validate_lazily();
+                    if constexpr (nullable<Trait>)
+                    {
+                        if (_state.load() & detail::lazy_state<true>::failed)
+                            return Trait::null;
+                    }
+                }
+            }
+            return _value;
+        }
+
+        [[nodiscard]] constexpr auto access() & noexcept(
+            noexcept(validate_lazily())
+            and (not is_lazy or not nullable<Trait> or nothrow_null_constructible<Trait>)
+        ) -> T &
+        {
+            if constexpr (is_lazy)
+            {
+                if !consteval
+                {
+                    validate_lazily();
+                    if constexpr (nullable<Trait>)
+                    {
+                        if (_state.load() & detail::lazy_state<true>::failed)
+                        {
+                            _value = Trait::null;
+                            _state.store(detail::lazy_state<true>::validated);
+                        }
+                    }
+                }
+            }
+            return _value;
+        }
+
+        static constexpr void record_construction() noexcept
+        {
+            if constexpr (Config.instrumented)
+            {
+                if !consteval { detail::instrumentation<self_type>::record_construction(); }
+            }
+        }
+
+        // find_violation, which is recorded by instrumentation if it is enabled
+        template <auto... Checked>
+        [[nodiscard]] constexpr auto run_checks(value_pack<Checked...> pack) const noexcept(
+            noexcept(run_checks(_value, pack))
+        ) -> std::size_t
+        { return run_checks(_value, pack); }
+
+        // run_checks of constraints preceding limit in constraint_pack, returns limit if they are satisfied
+        template <auto... Checked>
+        [[nodiscard]] constexpr auto run_checks_before(value_pack<Checked...> pack, std::size_t limit) const noexcept(
+            noexcept(find_violation_before(_value, pack, limit))
+        ) -> std::size_t
+        {
+            if constexpr (Config.instrumented)
+            {
+                if !consteval
+                {
+                    return detail::instrumentation<self_type>::template record_check<Config.cycle_sample_rate>([this, pack, limit] {
+                        return find_violation_before(_value, pack, limit);
+                    });
+                }
+            }
+            return find_violation_before(_value, pack, limit);
+        }
+
+        template <typename U, auto... Checked>
+        [[nodiscard]] static constexpr auto run_checks(U const & value, value_pack<Checked...> pack) noexcept(
+            noexcept(find_violation(value, pack))
+        ) -> std::size_t
+        {
+            if constexpr (Config.instrumented)
+            {
+                if !consteval
+                {
+                    return detail::instrumentation<self_type>::template record_check<Config.cycle_sample_rate>([&value, pack] {
+                        return find_violation(value, pack);
+                    });
+                }
+            }
+            return find_violation(value, pack);
+        }
+
+        /*
+         * Value of other satisfies its constraints, unless it's null or other's policy may skip checks
+         * So only target constraints missing in other's pack and not implied by its interval are checked
+         */
+        template <constrained_trait OtherTrait, configuration_point OtherConfig, auto... OtherConstraints>
+        constexpr void check_converted() noexcept(
+            noexcept(check(typename detail::unchecked_constraints<T, constraint_pack, OtherConstraints...>::type{}))
+            and ((detail::checks_every_value(OtherConfig) and not nullable<OtherTrait>) or noexcept(check()))
+        )
+        {
+            if constexpr (not detail::checks_every_value(OtherConfig))
+                check();
+            else
+            {
+                if constexpr (nullable<OtherTrait>)
+                {
+                    if (static_cast<bool>(_value == OtherTrait::null))
+                    {
+                        check();
+                        return;
+                    }
+                }
+                check(typename detail::unchecked_constraints<T, constraint_pack, OtherConstraints...>::type{});
             }
         }
 
@@ -328,6 +1143,123 @@ namespace ct
         }
     };
 
+    namespace detail
+    {
+        /*
+         * Reads raw value of constrained type, even if dereference operators are forwarded to T
+         */
+        struct raw_access
+        {
+            template <constrained ConstrainedType>
+            [[nodiscard]] static constexpr auto get(ConstrainedType const & x) noexcept(noexcept(x.access()))
+                -> typename ConstrainedType::value_type const &
+            { return x.access(); }
+        };
+
+        /*
+         * Constructs constrained type from value known to satisfy CoveredConstraints (e.g. by the way it was produced)
+         * Only constraints not implied by them are checked
+         */
+        struct covered_access
+        {
+            template <constrained ConstrainedType, auto... CoveredConstraints, typename... Args>
+            [[nodiscard]] static constexpr auto try_make(value_pack<CoveredConstraints...>, Args&&... args) noexcept(
+                noexcept(ConstrainedType::template try_make_checking<
+                    typename unchecked_constraints<
+                        typename ConstrainedType::value_type,
+                        typename ConstrainedType::constraint_pack,
+                        CoveredConstraints...
+                    >::type
+                >(std::forward<Args>(args)...))
+            ) -> std::expected<ConstrainedType, violation>
+            {
+                return ConstrainedType::template try_make_checking<
+                    typename unchecked_constraints<
+                        typename ConstrainedType::value_type,
+                        typename ConstrainedType::constraint_pack,
+                        CoveredConstraints...
+                    >::type
+                >(std::forward<Args>(args)...);
+            }
+        };
+
+        // Checks and constructs elements of static tables
+        struct constant_access
+        {
+            template <constrained ConstrainedType>
+            [[nodiscard]] static constexpr auto violation(auto const & value) -> std::size_t
+            { return ConstrainedType::constant_violation(value); }
+
+            template <constrained ConstrainedType>
+            [[nodiscard]] static constexpr auto make(auto const & value) -> ConstrainedType
+            { return ConstrainedType::make_constant(value); }
+        };
+    }
+
     template <typename T, auto... Constraints>
     using constrained_type = basic_constrained_type<T, default_traits<T>, configuration_point{}, Constraints...>;
+
+    template <typename T, auto... Constraints>
+    using lazy_constrained_type = basic_constrained_type<
+        T, default_traits<T>, configuration_point{.check_policy = check_policy::lazy}, Constraints...
+    >;
+
+    template <typename T, auto... Constraints>
+    using instrumented_constrained_type = basic_constrained_type<
+        T, default_traits<T>, configuration_point{.instrumented = true}, Constraints...
+    >;
+
+    /*
+     * Runs deferred checks of all lazy values in batch
+     */
+    template <constrained... ConstrainedTypes>
+    constexpr void validate_all(ConstrainedTypes const &... values)
+        noexcept((noexcept(values.validate_all()) && ...))
+    {
+        (values.validate_all(), ...);
+    }
+
+    /*
+     * Constructs ConstrainedType without exceptions on failed constraints
+     * Equivalent to ConstrainedType::try_make(args...)
+     */
+    template <constrained ConstrainedType, typename... Args>
+    [[nodiscard]] constexpr auto try_make(Args&&... args)
+        noexcept(noexcept(ConstrainedType::try_make(std::forward<Args>(args)...)))
+        -> std::expected<ConstrainedType, violation>
+    {
+        return ConstrainedType::try_make(std::forward<Args>(args)...);
+    }
+
+    /*
+     * Constant validated at compile time
+     * Equivalent to ConstrainedType::from_constant<Value>()
+     */
+    template <constrained ConstrainedType, auto Value>
+    [[nodiscard]] consteval auto make_static() -> ConstrainedType
+    { return ConstrainedType::template from_constant<Value>(); }
+
+    /*
+     * Table of constants validated at compile time, e.g. static constexpr routing or config table
+     * Values is std::array of values convertible to T, the first failed element and constraint are reported by static_assert
+     * Tables are constant initialized, so they aren't checked during static initialization
+     */
+    template <constrained ConstrainedType, auto Values>
+    [[nodiscard]] consteval auto make_static_table() -> std::array<ConstrainedType, Values.size()>
+    {
+        constexpr auto failure = []{
+            for (std::size_t i = 0; i < Values.size(); ++i)
+            {
+                auto const index = detail::constant_access::violation<ConstrainedType>(Values[i]);
+                if (index != ConstrainedType::constraint_pack::size)
+                    return std::pair{i, index};
+            }
+            return std::pair{Values.size(), ConstrainedType::constraint_pack::size};
+        }();
+        static_assert(detail::table_check<ConstrainedType, failure.first, failure.second>::value);
+
+        return []<std::size_t... Is>(std::index_sequence<Is...>) {
+            return std::array<ConstrainedType, Values.size()>{detail::constant_access::make<ConstrainedType>(Values[Is])...};
+        }(std::make_index_sequence<Values.size()>{});
+    }
 } // namespace ct
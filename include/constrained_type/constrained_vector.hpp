@@ -0,0 +1,329 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <expected>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <constrained_type/value_pack.hpp>
+#include <constrained_type/constrained_type.hpp>
+#include <constrained_type/validate.hpp>
+
+namespace ct
+{
+    /*
+     * Contiguous container of raw T, where every element satisfies Constraints
+     * Only new elements are checked on insertion, so the invariant costs O(1) per element
+     * Elements are read-only, insertion with failed constraints throws and leaves container unchanged
+     */
+    template <typename T, auto... Constraints>
+        requires (std::predicate<decltype(Constraints), T const &> && ...)
+    class constrained_vector
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using const_reference = T const &;
+        using const_pointer = T const *;
+        using const_iterator = typename std::vector<T>::const_iterator;
+        using iterator = const_iterator;
+        using const_reverse_iterator = typename std::vector<T>::const_reverse_iterator;
+        using constraint_pack = value_pack<Constraints...>;
+
+        // Scalar constrained type with the same constraint pack
+        using element_type = constrained_type<T, Constraints...>;
+
+#pragma region constructors
+        constexpr constrained_vector() noexcept = default;
+
+        constexpr constrained_vector(std::initializer_list<T> values)
+            : _values(values)
+        { validate_inserted(0, _values.size()); }
+
+        /*
+         * Takes ownership of values and checks all of them
+         */
+        constexpr explicit constrained_vector(std::vector<T> values)
+            : _values(std::move(values))
+        { validate_inserted(0, _values.size()); }
+
+        template <std::ranges::input_range Range>
+            requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+                and (not std::same_as<std::remove_cvref_t<Range>, constrained_vector>)
+                and (not std::same_as<std::remove_cvref_t<Range>, std::vector<T>>)
+        constexpr explicit constrained_vector(Range && range)
+        { append_range(std::forward<Range>(range)); }
+
+        constexpr constrained_vector(constrained_vector const &) = default;
+        constexpr constrained_vector(constrained_vector &&) noexcept = default;
+#pragma endregion constructors
+
+#pragma region assignments
+        constexpr auto operator=(constrained_vector const &) -> constrained_vector & = default;
+        constexpr auto operator=(constrained_vector &&) noexcept -> constrained_vector & = default;
+#pragma endregion assignments
+
+#pragma region access
+        [[nodiscard]] constexpr auto operator[](size_type i) const noexcept -> const_reference
+        { return _values[i]; }
+
+        [[nodiscard]] constexpr auto at(size_type i) const -> const_reference
+        { return _values.at(i); }
+
+        [[nodiscard]] constexpr auto front() const noexcept -> const_reference
+        { return _values.front(); }
+
+        [[nodiscard]] constexpr auto back() const noexcept -> const_reference
+        { return _values.back(); }
+
+        [[nodiscard]] constexpr auto data() const noexcept -> const_pointer
+        { return _values.data(); }
+
+        // Element as scalar constrained type, no checks are performed
+        [[nodiscard]] constexpr auto element(size_type i) const -> element_type
+        { return element_type{trusted, _values[i]}; }
+
+        /*
+         * View of raw values, every value satisfies Constraints
+         */
+        [[nodiscard]] constexpr auto span() const noexcept -> std::span<T const>
+        { return _values; }
+
+        [[nodiscard]] constexpr operator std::span<T const>() const noexcept
+        { return _values; }
+
+        /*
+         * Moves raw values out, container is left empty
+         */
+        [[nodiscard]] constexpr auto release() noexcept -> std::vector<T>
+        { return std::exchange(_values, {}); }
+#pragma endregion access
+
+#pragma region iterators
+        [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator { return _values.cbegin(); }
+        [[nodiscard]] constexpr auto end() const noexcept -> const_iterator { return _values.cend(); }
+        [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return _values.cbegin(); }
+        [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator { return _values.cend(); }
+        [[nodiscard]] constexpr auto rbegin() const noexcept -> const_reverse_iterator { return _values.crbegin(); }
+        [[nodiscard]] constexpr auto rend() const noexcept -> const_reverse_iterator { return _values.crend(); }
+#pragma endregion iterators
+
+#pragma region capacity
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool { return _values.empty(); }
+        [[nodiscard]] constexpr auto size() const noexcept -> size_type { return _values.size(); }
+        [[nodiscard]] constexpr auto max_size() const noexcept -> size_type { return _values.max_size(); }
+        [[nodiscard]] constexpr auto capacity() const noexcept -> size_type { return _values.capacity(); }
+        constexpr void reserve(size_type n) { _values.reserve(n); }
+        constexpr void shrink_to_fit() { _values.shrink_to_fit(); }
+#pragma endregion capacity
+
+#pragma region modifiers
+        constexpr void push_back(T const & value)
+        {
+            check(value);
+            _values.push_back(value);
+        }
+
+        constexpr void push_back(T && value)
+        {
+            check(value);
+            _values.push_back(std::move(value));
+        }
+
+        /*
+         * Values of constrained types covering Constraints are not checked again
+         */
+        template <constrained_trait OtherTrait, configuration_point OtherConfig, auto... OtherConstraints>
+        constexpr void push_back(basic_constrained_type<T, OtherTrait, OtherConfig, OtherConstraints...> const & value)
+        {
+            if constexpr (not detail::is_covered_by<T, constraint_pack, OtherTrait, OtherConfig, OtherConstraints...>)
+                check(*value);
+            _values.push_back(*value);
+        }
+
+        template <typename... Args>
+            requires std::constructible_from<T, Args...>
+        constexpr auto emplace_back(Args &&... args) -> const_reference
+        {
+            _values.emplace_back(std::forward<Args>(args)...);
+            validate_inserted(_values.size() - 1, 1);
+            return _values.back();
+        }
+
+        /*
+         * Appends value if it satisfies constraints, reports the first failed constraint otherwise
+         */
+        [[nodiscard]] constexpr auto try_push_back(T const & value) -> std::expected<void, violation>
+        {
+            auto const index = find_violation(value);
+            if (index != constraint_pack::size)
+                return std::unexpected{violation{index}};
+            _values.push_back(value);
+            return {};
+        }
+
+        constexpr auto insert(const_iterator pos, T const & value) -> const_iterator
+        {
+            check(value);
+            return _values.insert(pos, value);
+        }
+
+        constexpr auto insert(const_iterator pos, T && value) -> const_iterator
+        {
+            check(value);
+            return _values.insert(pos, std::move(value));
+        }
+
+        constexpr auto insert(const_iterator pos, size_type count, T const & value) -> const_iterator
+        {
+            if (count != 0)
+                check(value);
+            return _values.insert(pos, count, value);
+        }
+
+        template <std::input_iterator InputIterator>
+        constexpr auto insert(const_iterator pos, InputIterator first, InputIterator last) -> const_iterator
+        {
+            auto const offset = static_cast<size_type>(pos - cbegin());
+            auto const old_size = _values.size();
+            auto const result = _values.insert(pos, first, last);
+            validate_inserted(offset, _values.size() - old_size);
+            return result;
+        }
+
+        constexpr auto insert(const_iterator pos, std::initializer_list<T> values) -> const_iterator
+        { return insert(pos, values.begin(), values.end()); }
+
+        template <std::ranges::input_range Range>
+            requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+        constexpr auto insert_range(const_iterator pos, Range && range) -> const_iterator
+        {
+            auto && common = std::views::common(std::forward<Range>(range));
+            return insert(pos, std::ranges::begin(common), std::ranges::end(common));
+        }
+
+        /*
+         * Checks only appended values, contiguous arithmetic values are checked by SIMD kernels if possible
+         */
+        template <std::ranges::input_range Range>
+            requires std::convertible_to<std::ranges::range_reference_t<Range>, T>
+        constexpr void append_range(Range && range)
+        { insert_range(cend(), std::forward<Range>(range)); }
+
+        /*
+         * Replaces element at pos with value
+         */
+        constexpr void set(size_type pos, T value)
+        {
+            check(value);
+            _values[pos] = std::move(value);
+        }
+
+        // Removal never breaks the invariant
+        constexpr void pop_back() { _values.pop_back(); }
+        constexpr auto erase(const_iterator pos) -> const_iterator { return _values.erase(pos); }
+        constexpr auto erase(const_iterator first, const_iterator last) -> const_iterator { return _values.erase(first, last); }
+        constexpr void clear() noexcept { _values.clear(); }
+        constexpr void swap(constrained_vector & other) noexcept { _values.swap(other._values); }
+#pragma endregion modifiers
+
+        [[nodiscard]] constexpr auto operator==(constrained_vector const &) const -> bool = default;
+
+    private:
+        std::vector<T> _values;
+
+        [[nodiscard]] static constexpr auto find_violation(T const & value) -> std::size_t
+        {
+            std::size_t passed = 0;
+            static_cast<void>((
+                (std::invoke(Constraints, value) ? (++passed, true) : false) && ...
+            ));
+            return passed;
+        }
+
+        static constexpr void check(T const & value)
+        {
+            if (find_violation(value) != constraint_pack::size)
+                fail();
+        }
+
+        [[nodiscard]] static constexpr auto first_invalid(std::span<T const> values) -> std::size_t
+        {
+            if consteval
+            {
+                for (std::size_t i = 0; i < values.size(); ++i)
+                {
+                    if (find_violation(values[i]) != constraint_pack::size)
+                        return i;
+                }
+                return values.size();
+            }
+            else
+            {
+                return validate_first<element_type>(values);
+            }
+        }
+
+        /*
+         * Checks count values inserted at offset
+         * Inserted values are erased if any of them fails, so container is left unchanged
+         */
+        constexpr void validate_inserted(size_type offset, size_type count)
+        {
+            if (count == 0)
+                return;
+
+            auto const first = _values.begin() + static_cast<difference_type>(offset);
+            std::size_t index;
+            try
+            {
+                index = first_invalid(std::span<T const>{_values.data() + offset, count});
+            }
+            catch (...)
+            {
+                _values.erase(first, first + static_cast<difference_type>(count));
+                throw;
+            }
+
+            if (index != count)
+            {
+                _values.erase(first, first + static_cast<difference_type>(count));
+                fail();
+            }
+        }
+
+        [[noreturn]] static constexpr void fail()
+        {
+            throw std::logic_error{"Constraints not satisfied"};
+        }
+    };
+
+    namespace detail
+    {
+        template <typename T, auto... Constraints>
+        consteval auto constrained_vector_of(value_pack<Constraints...>*) -> constrained_vector<T, Constraints...>;
+    }
+
+    /*
+     * constrained_vector with elements constrained like ConstrainedType
+     * constrained_vector_for<constrained_type<int, gt<0>>> <=> constrained_vector<int, gt<0>>
+     */
+    template <constrained ConstrainedType>
+    using constrained_vector_for = decltype(
+        detail::constrained_vector_of<typename ConstrainedType::value_type>(
+            static_cast<typename ConstrainedType::constraint_pack*>(nullptr)
+        )
+    );
+
+    template <typename T, auto... Constraints>
+    constexpr void swap(constrained_vector<T, Constraints...> & x, constrained_vector<T, Constraints...> & y) noexcept
+    { x.swap(y); }
+} // namespace ct
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <constrained_type/constrained_type.hpp>
+
+namespace ct
+{
+    namespace detail
+    {
+        /*
+         * Type, which all lookup keys of T are converted to before hashing and comparison
+         * basic_string keys are looked up by basic_string_view, so string literals and views don't allocate
+         */
+        template <typename T>
+        struct lookup_key
+        {
+            using type = T;
+        };
+
+        template <typename Char, typename Traits, typename Allocator>
+        struct lookup_key<std::basic_string<Char, Traits, Allocator>>
+        {
+            using type = std::basic_string_view<Char, Traits>;
+        };
+
+        template <typename T>
+        using lookup_key_t = typename lookup_key<T>::type;
+
+        template <typename T>
+        concept hashable = requires (T const & x)
+        {
+            { std::hash<T>{}(x) } -> std::convertible_to<std::size_t>;
+        };
+
+        /*
+         * Lookup key U of ConstrainedType: constrained value, its raw value, lookup key,
+         * or other type converted to lookup key without narrowing (e.g. char const * to std::string_view)
+         * Arithmetic keys must match exactly, so 1.5 or 4294967297LL doesn't find 1
+         */
+        template <typename U, typename ConstrainedType>
+        concept lookup_key_for =
+            std::same_as<U, ConstrainedType>
+            or std::same_as<U, typename ConstrainedType::value_type>
+            or std::same_as<U, lookup_key_t<typename ConstrainedType::value_type>>
+            or (
+                not std::is_arithmetic_v<U>
+                and not std::is_arithmetic_v<lookup_key_t<typename ConstrainedType::value_type>>
+                and std::is_convertible_v<U const &, lookup_key_t<typename ConstrainedType::value_type>>
+                and requires (U const & x) { lookup_key_t<typename ConstrainedType::value_type>{x}; }
+            );
+
+        // Raw value of constrained type or lookup key itself, constrained values are not checked again
+        template <typename Key>
+        [[nodiscard]] constexpr auto as_lookup_key(auto const & x) noexcept(noexcept(Key(raw_access::get(x)))) -> Key
+            requires constrained<std::remove_cvref_t<decltype(x)>>
+        { return Key(raw_access::get(x)); }
+
+        template <typename Key>
+        [[nodiscard]] constexpr auto as_lookup_key(auto const & x) noexcept(std::is_nothrow_convertible_v<decltype(x), Key>) -> Key
+            requires (not constrained<std::remove_cvref_t<decltype(x)>>)
+        { return x; }
+    } // namespace detail
+
+    /*
+     * Transparent hash for unordered containers keyed by ConstrainedType
+     * Hashes constrained values and raw lookup keys (T, or std::basic_string_view for std::basic_string) equally,
+     * so containers can be searched by raw values without constructing and checking constrained type
+     * Keys of other types are accepted only if they are converted without narrowing (see lookup_key_for)
+     */
+    template <constrained ConstrainedType>
+        requires detail::hashable<detail::lookup_key_t<typename ConstrainedType::value_type>>
+    struct transparent_hash
+    {
+        using is_transparent = void;
+        using key_type = detail::lookup_key_t<typename ConstrainedType::value_type>;
+
+        template <detail::lookup_key_for<ConstrainedType> U>
+        [[nodiscard]] constexpr auto operator()(U const & x) const noexcept(
+            noexcept(std::hash<key_type>{}(detail::as_lookup_key<key_type>(x)))
+        ) -> std::size_t
+        { return std::hash<key_type>{}(detail::as_lookup_key<key_type>(x)); }
+    };
+
+    /*
+     * Transparent equality matching transparent_hash
+     */
+    template <constrained ConstrainedType>
+    struct transparent_equal
+    {
+        using is_transparent = void;
+        using key_type = detail::lookup_key_t<typename ConstrainedType::value_type>;
+
+        template <detail::lookup_key_for<ConstrainedType> U, detail::lookup_key_for<ConstrainedType> V>
+        [[nodiscard]] constexpr auto operator()(U const & x, V const & y) const noexcept(
+            noexcept(static_cast<bool>(detail::as_lookup_key<key_type>(x) == detail::as_lookup_key<key_type>(y)))
+        ) -> bool
+        { return static_cast<bool>(detail::as_lookup_key<key_type>(x) == detail::as_lookup_key<key_type>(y)); }
+    };
+} // namespace ct
+
+/*
+ * Constrained values are hashed as their raw values
+ */
+template <ct::constrained ConstrainedType>
+    requires ct::detail::hashable<typename ConstrainedType::value_type>
+struct std::hash<ConstrainedType>
+{
+    [[nodiscard]] auto operator()(ConstrainedType const & x) const noexcept(
+        noexcept(std::hash<typename ConstrainedType::value_type>{}(ct::detail::raw_access::get(x)))
+    ) -> std::size_t
+    { return std::hash<typename ConstrainedType::value_type>{}(ct::detail::raw_access::get(x)); }
+};
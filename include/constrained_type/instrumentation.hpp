@@ -0,0 +1,223 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*
+ * Only types with configuration_point::instrumented are instrumented
+ * Instrumentation is part of the type, so it never depends on macros defined in the translation unit
+ */
+namespace ct
+{
+    /*
+     * Snapshot of counters of one constrained type
+     */
+    struct type_statistics
+    {
+        std::string_view name;
+        std::uint64_t constructions = 0;
+        std::uint64_t checks = 0;
+        std::uint64_t failures = 0;
+        // Failures by index of the first failed constraint in constraint_pack
+        std::vector<std::uint64_t> failures_by_constraint;
+        // Checks measured by cycle sampler and ticks spent in their predicates
+        std::uint64_t timed_checks = 0;
+        std::uint64_t ticks = 0;
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        consteval auto type_name() -> std::string_view
+        {
+            constexpr std::string_view function = __PRETTY_FUNCTION__;
+            constexpr std::string_view prefix = "T = ";
+            constexpr auto first = function.find(prefix) + prefix.size();
+            constexpr auto last = function.find_first_of(";]", first);
+            return function.substr(first, last - first);
+        }
+
+        [[nodiscard]] inline auto ticks() noexcept -> std::uint64_t
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            return __builtin_ia32_rdtsc();
+#else
+            return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+        }
+
+        /*
+         * Counters of one constrained type, linked into global lock-free registry
+         * Counters are relaxed atomics, so they are exact but not ordered with other memory
+         */
+        struct type_counters
+        {
+            std::string_view name;
+            std::span<std::atomic<std::uint64_t>> failures_by_constraint;
+            std::atomic<std::uint64_t> constructions{0};
+            std::atomic<std::uint64_t> checks{0};
+            std::atomic<std::uint64_t> failures{0};
+            std::atomic<std::uint64_t> timed_checks{0};
+            std::atomic<std::uint64_t> ticks{0};
+            type_counters * next = nullptr;
+
+            type_counters(std::string_view name, std::span<std::atomic<std::uint64_t>> failures_by_constraint) noexcept;
+
+            type_counters(type_counters const &) = delete;
+            auto operator=(type_counters const &) -> type_counters & = delete;
+        };
+
+        inline constinit std::atomic<type_counters *> registry_head{nullptr};
+
+        inline type_counters::type_counters(
+            std::string_view name,
+            std::span<std::atomic<std::uint64_t>> failures_by_constraint
+        ) noexcept
+            : name{name}
+            , failures_by_constraint{failures_by_constraint}
+        {
+            next = registry_head.load(std::memory_order_relaxed);
+            while (not registry_head.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed))
+                ;
+        }
+
+        template <std::size_t ConstraintCount>
+        struct type_counters_storage
+        {
+            std::array<std::atomic<std::uint64_t>, ConstraintCount> failures_by_constraint{};
+            type_counters counters;
+
+            explicit type_counters_storage(std::string_view name) noexcept
+                : counters{name, failures_by_constraint}
+            {}
+        };
+
+        /*
+         * Instrumentation hooks of ConstrainedType
+         * Counters are registered on the first use
+         */
+        template <typename ConstrainedType>
+        struct instrumentation
+        {
+            template <std::uint32_t SampleRate>
+            static inline thread_local std::uint32_t countdown = 1;
+
+            static auto counters() noexcept -> type_counters &
+            {
+                static type_counters_storage<ConstrainedType::constraint_pack::size> storage{
+                    type_name<ConstrainedType>()
+                };
+                return storage.counters;
+            }
+
+            static void record_construction() noexcept
+            {
+                counters().constructions.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            /*
+             * Runs find_violation and records its result
+             * Every SampleRate-th call in each thread is timed, 0 disables timing
+             */
+            template <std::uint32_t SampleRate, typename FindViolation>
+            static auto record_check(FindViolation && find_violation) -> std::size_t
+            {
+                auto & c = counters();
+                std::size_t index;
+                if constexpr (SampleRate > 0)
+                {
+                    if (--countdown<SampleRate> == 0)
+                    {
+                        countdown<SampleRate> = SampleRate;
+                        auto const start = ticks();
+                        index = find_violation();
+                        auto const elapsed = ticks() - start;
+                        c.timed_checks.fetch_add(1, std::memory_order_relaxed);
+                        c.ticks.fetch_add(elapsed, std::memory_order_relaxed);
+                    }
+                    else
+                        index = find_violation();
+                }
+                else
+                    index = find_violation();
+
+                c.checks.fetch_add(1, std::memory_order_relaxed);
+                if (index != ConstrainedType::constraint_pack::size)
+                {
+                    c.failures.fetch_add(1, std::memory_order_relaxed);
+                    c.failures_by_constraint[index].fetch_add(1, std::memory_order_relaxed);
+                }
+                return index;
+            }
+        };
+    } // namespace detail
+
+    /*
+     * Copies counters of every instrumented type used so far
+     */
+    [[nodiscard]] inline auto instrumentation_snapshot() -> std::vector<type_statistics>
+    {
+        std::vector<type_statistics> result;
+        for (auto * c = detail::registry_head.load(std::memory_order_acquire); c != nullptr; c = c->next)
+        {
+            type_statistics s;
+            s.name = c->name;
+            s.constructions = c->constructions.load(std::memory_order_relaxed);
+            s.checks = c->checks.load(std::memory_order_relaxed);
+            s.failures = c->failures.load(std::memory_order_relaxed);
+            s.timed_checks = c->timed_checks.load(std::memory_order_relaxed);
+            s.ticks = c->ticks.load(std::memory_order_relaxed);
+            for (auto const & f : c->failures_by_constraint)
+                s.failures_by_constraint.push_back(f.load(std::memory_order_relaxed));
+            result.push_back(std::move(s));
+        }
+        return result;
+    }
+
+    /*
+     * Sets counters of every instrumented type to zero
+     */
+    inline void reset_instrumentation() noexcept
+    {
+        for (auto * c = detail::registry_head.load(std::memory_order_acquire); c != nullptr; c = c->next)
+        {
+            for (auto * counter : {&c->constructions, &c->checks, &c->failures, &c->timed_checks, &c->ticks})
+                counter->store(0, std::memory_order_relaxed);
+            for (auto & f : c->failures_by_constraint)
+                f.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /*
+     * Writes snapshot as text, one type per block
+     */
+    inline void dump_instrumentation(std::ostream & out)
+    {
+        for (auto const & s : instrumentation_snapshot())
+        {
+            out << s.name << '\n'
+                << "  constructions: " << s.constructions << '\n'
+                << "  checks: " << s.checks << '\n'
+                << "  failures: " << s.failures << '\n';
+            for (std::size_t i = 0; i < s.failures_by_constraint.size(); ++i)
+            {
+                if (s.failures_by_constraint[i] != 0)
+                    out << "    constraint " << i << ": " << s.failures_by_constraint[i] << '\n';
+            }
+            if (s.timed_checks != 0)
+            {
+                out << "  timed checks: " << s.timed_checks
+                    << ", ticks per check: " << s.ticks / s.timed_checks << '\n';
+            }
+        }
+    }
+} // namespace ct
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <constrained_type/value_pack.hpp>
+#include <constrained_type/normalize.hpp>
+#include <constrained_type/combinators/operators.hpp>
+
+namespace ct
+{
+    namespace detail
+    {
+        template <typename T>
+        concept interval_value =
+            std::integral<T>
+            and not std::same_as<T, bool>;
+
+        /*
+         * Closed interval [lo, hi] of integral values
+         * bounded is false if nothing is known about the value, empty interval has lo > hi
+         */
+        template <interval_value T>
+        struct interval
+        {
+            T lo = std::numeric_limits<T>::min();
+            T hi = std::numeric_limits<T>::max();
+            bool bounded = false;
+
+            // Constraint is satisfied by a value if and only if the value is in the interval
+            bool exact = false;
+
+            [[nodiscard]] constexpr auto empty() const noexcept -> bool
+            { return lo > hi; }
+
+            [[nodiscard]] constexpr auto contains(interval const & other) const noexcept -> bool
+            { return other.empty() or (lo <= other.lo and other.hi <= hi); }
+
+            [[nodiscard]] constexpr auto intersect(interval const & other) const noexcept -> interval
+            {
+                return {
+                    std::max(lo, other.lo),
+                    std::min(hi, other.hi),
+                    bounded or other.bounded,
+                    exact and other.exact
+                };
+            }
+        };
+
+        template <interval_value T>
+        consteval auto to_interval(bound<T> const & b) -> interval<T>
+        {
+            constexpr T min = std::numeric_limits<T>::min();
+            constexpr T max = std::numeric_limits<T>::max();
+            switch (b.kind)
+            {
+            case bound_kind::lower:
+                if (b.exclusive and b.value == max)
+                    return {max, min, true, true};
+                return {b.exclusive ? static_cast<T>(b.value + 1) : b.value, max, true, true};
+            case bound_kind::upper:
+                if (b.exclusive and b.value == min)
+                    return {max, min, true, true};
+                return {min, b.exclusive ? static_cast<T>(b.value - 1) : b.value, true, true};
+            case bound_kind::equal:
+                return {b.value, b.value, true, true};
+            default:
+                return {};
+            }
+        }
+
+        /*
+         * Interval of values of type T satisfying Combinator
+         * Relational combinators, in_range and and_ of them are exact,
+         * any other combinator tells nothing about the value
+         */
+        template <typename Combinator, typename T>
+        struct interval_of
+        {
+            static constexpr interval<T> value = to_interval(bound_of<Combinator, T>::value);
+        };
+
+        template <auto Lo, auto Hi, typename T>
+            requires (is_exact_constant<T, Lo>() and is_exact_constant<T, Hi>())
+        struct interval_of<in_range<Lo, Hi>, T>
+        {
+            static constexpr interval<T> value{static_cast<T>(Lo), static_cast<T>(Hi), true, true};
+        };
+
+        template <auto... Args, typename T>
+            requires (sizeof...(Args) > 1)
+        struct interval_of<and_<Args...>, T>
+        {
+            static constexpr interval<T> value = []{
+                interval<T> result{.exact = true};
+                ((result = result.intersect(interval_of<std::remove_cv_t<decltype(Args)>, T>::value)), ...);
+                return result;
+            }();
+        };
+
+        // Intersection of intervals of every constraint in ConstraintPack
+        template <typename T, typename ConstraintPack>
+        struct pack_interval;
+
+        template <typename T, auto... Constraints>
+        struct pack_interval<T, value_pack<Constraints...>>
+        {
+            static constexpr interval<T> value = []{
+                interval<T> result{};
+                ((result = result.intersect(interval_of<std::remove_cv_t<decltype(Constraints)>, T>::value)), ...);
+                return result;
+            }();
+        };
+
+        /*
+         * Constraints of ConstraintPack, which are not guaranteed for value satisfying OtherConstraints
+         * Constraint is guaranteed if it is in OtherConstraints or if it is exact interval containing
+         * the interval of OtherConstraints
+         */
+        template <typename T, typename ConstraintPack, auto... OtherConstraints>
+        struct unchecked_constraints
+        {
+            using type = typename ConstraintPack::template remove<OtherConstraints...>;
+        };
+
+        template <interval_value T, auto... Constraints, auto... OtherConstraints>
+        struct unchecked_constraints<T, value_pack<Constraints...>, OtherConstraints...>
+        {
+            using remaining = typename value_pack<Constraints...>::template remove<OtherConstraints...>;
+
+            template <typename Pack>
+            struct filter;
+
+            template <auto... Remaining>
+            struct filter<value_pack<Remaining...>>
+            {
+                static constexpr auto source = pack_interval<T, value_pack<OtherConstraints...>>::value;
+
+                template <auto Constraint>
+                static consteval auto is_implied() -> bool
+                {
+                    constexpr auto target = interval_of<std::remove_cv_t<decltype(Constraint)>, T>::value;
+                    return source.bounded and target.exact and target.contains(source);
+                }
+
+                static constexpr std::array<bool, sizeof...(Remaining)> implied{is_implied<Remaining>()...};
+
+                static constexpr auto kept = []{
+                    std::array<std::size_t, sizeof...(Remaining)> result{};
+                    std::size_t count = 0;
+                    for (std::size_t i = 0; i < implied.size(); ++i)
+                    {
+                        if (not implied[i])
+                            result[count++] = i;
+                    }
+                    return std::pair{result, count};
+                }();
+
+                template <std::size_t... Is>
+                static consteval auto pick(std::index_sequence<Is...>)
+                {
+                    if constexpr (sizeof...(Is) == 0)
+                        return value_pack<>{};
+                    else
+                        return typename value_pack<Remaining...>::template get_many<kept.first[Is]...>{};
+                }
+
+                using type = decltype(pick(std::make_index_sequence<kept.second>{}));
+            };
+
+            using type = typename filter<remaining>::type;
+        };
+    } // namespace detail
+} // namespace ct
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <constrained_type/value_pack.hpp>
+#include <constrained_type/combinators/operators.hpp>
+
+namespace ct
+{
+    namespace detail
+    {
+        enum class bound_kind
+        {
+            none,
+            lower,
+            upper,
+            equal,
+        };
+
+        template <typename T>
+        struct bound
+        {
+            bound_kind kind = bound_kind::none;
+            bool exclusive = false;
+            T value{};
+        };
+
+        /*
+         * Maps relational combinator with simple arithmetic value to interval bound
+         * Every other constraint is kept by normalization as is
+         */
+        template <typename Combinator, typename T>
+        struct bound_of
+        {
+            static constexpr bound<T> value{};
+        };
+
+#define CONSTRAINED_TYPE_RELATIONAL_BOUND(name, kind, exclusive) \
+        template <auto A, typename T> \
+            requires (is_exact_constant<T, A>()) \
+        struct bound_of<name<A>, T> \
+        { \
+            static constexpr bound<T> value{bound_kind::kind, exclusive, static_cast<T>(A)}; \
+        };
+
+        CONSTRAINED_TYPE_RELATIONAL_BOUND(gt, lower, true)
+        CONSTRAINED_TYPE_RELATIONAL_BOUND(ge, lower, false)
+        CONSTRAINED_TYPE_RELATIONAL_BOUND(lt, upper, true)
+        CONSTRAINED_TYPE_RELATIONAL_BOUND(le, upper, false)
+        CONSTRAINED_TYPE_RELATIONAL_BOUND(eq, equal, false)
+
+#undef CONSTRAINED_TYPE_RELATIONAL_BOUND
+
+        /*
+         * Folds bounds of unique ConstraintPack into the tightest interval
+         * Result keeps indices of constraints to evaluate: interval bounds first, then the rest in order
+         */
+        template <typename T, typename ConstraintPack>
+        struct normalizer;
+
+        template <typename T, auto... Constraints>
+        struct normalizer<T, value_pack<Constraints...>>
+        {
+            static constexpr std::size_t size = sizeof...(Constraints);
+
+            struct result
+            {
+                std::array<std::size_t, size> kept{};
+                std::size_t count = 0;
+                bool satisfiable = true;
+            };
+
+            // Tighter bound of the same kind
+            static consteval auto tighter(bound<T> const & x, bound<T> const & y) -> bool
+            {
+                if (x.value == y.value)
+                    return x.exclusive and not y.exclusive;
+                return x.kind == bound_kind::lower ? x.value > y.value : x.value < y.value;
+            }
+
+            static consteval auto satisfiable(bound<T> const & lower, bound<T> const & upper) -> bool
+            {
+                if constexpr (std::is_integral_v<T>)
+                {
+                    // Integers have no values between x and x + 1
+                    if (lower.exclusive and lower.value == std::numeric_limits<T>::max())
+                        return false;
+                    if (upper.exclusive and upper.value == std::numeric_limits<T>::min())
+                        return false;
+                    T const lo = lower.exclusive ? static_cast<T>(lower.value + 1) : lower.value;
+                    T const hi = upper.exclusive ? static_cast<T>(upper.value - 1) : upper.value;
+                    return lo <= hi;
+                }
+                else
+                {
+                    if (lower.value == upper.value)
+                        return not lower.exclusive and not upper.exclusive;
+                    return lower.value < upper.value;
+                }
+            }
+
+            static consteval auto compute() -> result
+            {
+                result r;
+                if constexpr (not std::is_arithmetic_v<T>)
+                {
+                    for (std::size_t i = 0; i < size; ++i)
+                        r.kept[r.count++] = i;
+                }
+                else
+                {
+                    constexpr std::array<bound<T>, size> bounds{
+                        bound_of<std::remove_cv_t<decltype(Constraints)>, T>::value...
+                    };
+
+                    constexpr std::size_t none = size;
+                    std::size_t lower = none;
+                    std::size_t upper = none;
+                    std::size_t equal = none;
+                    for (std::size_t i = 0; i < size; ++i)
+                    {
+                        auto const & b = bounds[i];
+                        if (b.kind == bound_kind::lower and (lower == none or tighter(b, bounds[lower])))
+                            lower = i;
+                        else if (b.kind == bound_kind::upper and (upper == none or tighter(b, bounds[upper])))
+                            upper = i;
+                        else if (b.kind == bound_kind::equal)
+                        {
+                            if (equal != none and bounds[equal].value != b.value)
+                                r.satisfiable = false;
+                            equal = i;
+                        }
+                    }
+
+                    if (lower != none and upper != none and not satisfiable(bounds[lower], bounds[upper]))
+                        r.satisfiable = false;
+
+                    if (equal != none)
+                    {
+                        // x == c implies every satisfied bound, so bounds are dropped
+                        bound<T> const point{bound_kind::none, false, bounds[equal].value};
+                        if (lower != none and not satisfiable(bounds[lower], point))
+                            r.satisfiable = false;
+                        if (upper != none and not satisfiable(point, bounds[upper]))
+                            r.satisfiable = false;
+                        r.kept[r.count++] = equal;
+                    }
+                    else
+                    {
+                        if (lower != none)
+                            r.kept[r.count++] = lower;
+                        if (upper != none)
+                            r.kept[r.count++] = upper;
+                    }
+
+                    for (std::size_t i = 0; i < size; ++i)
+                    {
+                        if (bounds[i].kind == bound_kind::none)
+                            r.kept[r.count++] = i;
+                    }
+                }
+                return r;
+            }
+
+            static constexpr result value = compute();
+
+            static_assert(value.satisfiable, "Constraint pack is unsatisfiable");
+
+            template <std::size_t... Is>
+            static consteval auto pick(std::index_sequence<Is...>)
+            {
+                if constexpr (sizeof...(Is) == 0)
+                    return value_pack<>{};
+                else
+                    return typename value_pack<Constraints...>::template get_many<value.kept[Is]...>{};
+            }
+
+            using type = decltype(pick(std::make_index_sequence<value.count>{}));
+        };
+
+        template <bool Normalize, typename T, typename ConstraintPack>
+        struct maybe_normalize
+        {
+            using type = ConstraintPack;
+        };
+
+        template <typename T, typename ConstraintPack>
+        struct maybe_normalize<true, T, ConstraintPack>
+        {
+            using type = typename normalizer<T, typename ConstraintPack::unique>::type;
+        };
+    } // namespace detail
+
+    /*
+     * Minimal pack equivalent to ConstraintPack for values of type T
+     * - Duplicates are removed
+     * - Relational combinators with simple arithmetic values are folded into one interval
+     * - Unsatisfiable packs are rejected at compile time
+     */
+    template <typename T, typename ConstraintPack>
+    using normalize_constraint_pack = typename detail::maybe_normalize<true, T, ConstraintPack>::type;
+} // namespace ct
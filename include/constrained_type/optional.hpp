@@ -0,0 +1,301 @@
+#pragma once
+
+#include <concepts>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <constrained_type/value_pack.hpp>
+#include <constrained_type/constrained_type.hpp>
+#include <constrained_type/interval.hpp>
+
+namespace ct
+{
+    namespace detail
+    {
+        /*
+         * Source of niche, a value which is never held by constrained type and marks empty optional
+         * trait    - Trait::niche
+         * null     - Trait::null of nullable trait
+         * interval - value next to the interval of integral constraint pack
+         * constant - NaN for floating point T or T{} for other scalars, if rejected by constraints at compile time
+         * interval and constant niches are used only if every constructed value is checked,
+         * otherwise unchecked (sampled, lazy, release debug_only) value may be equal to the niche
+         */
+        enum class niche_source
+        {
+            none,
+            trait,
+            null,
+            interval,
+            constant,
+        };
+
+        template <typename Trait>
+        concept niche_trait = requires
+        {
+            requires std::same_as<decltype(Trait::niche), typename Trait::value_type const>;
+        };
+
+        // Every constraint can be evaluated for V at compile time and some of them fails
+        template <typename T, auto V, auto... Constraints>
+        concept rejects_constant =
+            requires { typename std::bool_constant<(static_cast<bool>(std::invoke(Constraints, static_cast<T>(V))) && ...)>; }
+            and not (static_cast<bool>(std::invoke(Constraints, static_cast<T>(V))) && ...);
+
+        template <typename T, auto V, typename ConstraintPack>
+        inline constexpr bool pack_rejects_constant = false;
+
+        template <typename T, auto V, auto... Constraints>
+        inline constexpr bool pack_rejects_constant<T, V, value_pack<Constraints...>> = rejects_constant<T, V, Constraints...>;
+
+        template <typename T>
+        consteval auto niche_candidate() -> T
+        {
+            if constexpr (std::floating_point<T>)
+                return std::numeric_limits<T>::quiet_NaN();
+            else
+                return T{};
+        }
+
+        template <typename T, typename ConstraintPack>
+        consteval auto interval_niche() -> std::optional<T>
+        {
+            if constexpr (interval_value<T>)
+            {
+                constexpr auto bounds = pack_interval<T, ConstraintPack>::value;
+                if (bounds.bounded and not bounds.empty())
+                {
+                    if (bounds.lo != std::numeric_limits<T>::min())
+                        return static_cast<T>(bounds.lo - 1);
+                    if (bounds.hi != std::numeric_limits<T>::max())
+                        return static_cast<T>(bounds.hi + 1);
+                }
+            }
+            return std::nullopt;
+        }
+
+        template <constrained ConstrainedType>
+        inline constexpr bool holds_checked_values =
+            checks_every_value(ConstrainedType::config_value)
+            and ConstrainedType::config_value.check_policy != check_policy::lazy;
+
+        template <constrained ConstrainedType>
+        consteval auto niche_source_of() -> niche_source
+        {
+            using value_t = typename ConstrainedType::value_type;
+            using trait_t = typename ConstrainedType::trait_type;
+            using pack_t = typename ConstrainedType::constraint_pack;
+
+            if constexpr (niche_trait<trait_t>)
+                return niche_source::trait;
+            else if constexpr (nullable<trait_t>)
+                return niche_source::null;
+            else if constexpr (not holds_checked_values<ConstrainedType>)
+                return niche_source::none;
+            else if constexpr (interval_niche<value_t, pack_t>().has_value())
+                return niche_source::interval;
+            else if constexpr (std::is_scalar_v<value_t> and not std::is_null_pointer_v<value_t>)
+            {
+                if constexpr (pack_rejects_constant<value_t, niche_candidate<value_t>(), pack_t>)
+                    return niche_source::constant;
+                else
+                    return niche_source::none;
+            }
+            else
+                return niche_source::none;
+        }
+
+        template <constrained ConstrainedType, niche_source Source = niche_source_of<ConstrainedType>()>
+        struct niche
+        {
+            static constexpr bool exists = false;
+        };
+
+        template <constrained ConstrainedType, niche_source Source>
+            requires (Source != niche_source::none)
+        struct niche<ConstrainedType, Source>
+        {
+            using value_t = typename ConstrainedType::value_type;
+
+            static constexpr bool exists = true;
+
+            static constexpr value_t value = []{
+                if constexpr (Source == niche_source::trait)
+                    return ConstrainedType::trait_type::niche;
+                else if constexpr (Source == niche_source::null)
+                    return ConstrainedType::trait_type::null;
+                else if constexpr (Source == niche_source::interval)
+                    return *interval_niche<value_t, typename ConstrainedType::constraint_pack>();
+                else
+                    return niche_candidate<value_t>();
+            }();
+
+            // NaN niche matches any NaN, because NaN is not equal to itself
+            [[nodiscard]] static constexpr auto holds(value_t const & x) noexcept(noexcept(static_cast<bool>(x == value))) -> bool
+            {
+                if constexpr (std::floating_point<value_t>)
+                {
+                    if (value != value)
+                        return x != x;
+                }
+                return static_cast<bool>(x == value);
+            }
+        };
+    } // namespace detail
+
+    /*
+     * Optional constrained value without extra storage
+     * Empty state is held as a niche value violating constraints, so sizeof(optional<C>) == sizeof(C)
+     * Niche is Trait::niche, Trait::null of nullable traits (null values are empty), value outside of
+     * the interval of integral constraints or NaN/T{} rejected by constraints at compile time (for checked types only)
+     * Types without niche fall back to std::optional<C>
+     */
+    template <constrained ConstrainedType>
+    class optional
+    {
+    public:
+        using value_type = ConstrainedType;
+
+#pragma region constructors
+        constexpr optional() noexcept(std::is_nothrow_copy_constructible_v<raw_type>)
+            : _value{unchecked_tag{}, niche_type::value}
+        {}
+
+        constexpr optional(std::nullopt_t) noexcept(std::is_nothrow_copy_constructible_v<raw_type>)
+            : optional{}
+        {}
+
+        constexpr optional(ConstrainedType const & value) noexcept(std::is_nothrow_copy_constructible_v<ConstrainedType>)
+            : _value{value}
+        {}
+
+        constexpr optional(ConstrainedType && value) noexcept(std::is_nothrow_move_constructible_v<ConstrainedType>)
+            : _value{std::move(value)}
+        {}
+
+        /*
+         * Constructs value in place, constraints are checked by ConstrainedType
+         */
+        template <typename... Args>
+            requires std::is_constructible_v<ConstrainedType, Args...>
+        constexpr explicit optional(std::in_place_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<ConstrainedType, Args...>)
+            : _value(std::forward<Args>(args)...)
+        {}
+
+        constexpr optional(optional const &) = default;
+        constexpr optional(optional &&) = default;
+#pragma endregion constructors
+
+#pragma region assignments
+        constexpr auto operator=(optional const &) -> optional & = default;
+        constexpr auto operator=(optional &&) -> optional & = default;
+
+        constexpr auto operator=(std::nullopt_t) noexcept(noexcept(reset())) -> optional &
+        {
+            reset();
+            return *this;
+        }
+
+        constexpr auto operator=(ConstrainedType const & value) noexcept(std::is_nothrow_copy_assignable_v<ConstrainedType>) -> optional &
+        {
+            _value = value;
+            return *this;
+        }
+
+        constexpr auto operator=(ConstrainedType && value) noexcept(std::is_nothrow_move_assignable_v<ConstrainedType>) -> optional &
+        {
+            _value = std::move(value);
+            return *this;
+        }
+#pragma endregion assignments
+
+#pragma region modifiers
+        template <typename... Args>
+            requires std::is_constructible_v<ConstrainedType, Args...>
+        constexpr auto emplace(Args&&... args) -> ConstrainedType &
+        {
+            _value = ConstrainedType(std::forward<Args>(args)...);
+            return _value;
+        }
+
+        constexpr void reset() noexcept(std::is_nothrow_copy_constructible_v<raw_type> and std::is_nothrow_move_assignable_v<ConstrainedType>)
+        { _value = ConstrainedType{unchecked_tag{}, niche_type::value}; }
+
+        constexpr void swap(optional & other) noexcept(std::is_nothrow_swappable_v<ConstrainedType>)
+        {
+            using std::swap;
+            swap(_value, other._value);
+        }
+#pragma endregion modifiers
+
+#pragma region observers
+        [[nodiscard]] constexpr auto has_value() const noexcept(noexcept(niche_type::holds(std::declval<raw_type const &>()))) -> bool
+        { return not niche_type::holds(_value._value); }
+
+        [[nodiscard]] constexpr explicit operator bool() const noexcept(noexcept(has_value()))
+        { return has_value(); }
+
+        [[nodiscard]] constexpr auto operator*() const & noexcept -> ConstrainedType const & { return _value; }
+        [[nodiscard]] constexpr auto operator*() & noexcept -> ConstrainedType & { return _value; }
+        [[nodiscard]] constexpr auto operator*() && noexcept -> ConstrainedType && { return std::move(_value); }
+        [[nodiscard]] constexpr auto operator*() const && noexcept -> ConstrainedType const && { return std::move(_value); }
+
+        [[nodiscard]] constexpr auto operator->() const noexcept -> ConstrainedType const * { return &_value; }
+        [[nodiscard]] constexpr auto operator->() noexcept -> ConstrainedType * { return &_value; }
+
+        [[nodiscard]] constexpr auto value() const & -> ConstrainedType const &
+        {
+            if (not has_value())
+                throw std::bad_optional_access{};
+            return _value;
+        }
+
+        [[nodiscard]] constexpr auto value() && -> ConstrainedType &&
+        {
+            if (not has_value())
+                throw std::bad_optional_access{};
+            return std::move(_value);
+        }
+
+        template <typename U>
+            requires std::is_convertible_v<U, ConstrainedType>
+        [[nodiscard]] constexpr auto value_or(U && fallback) const & -> ConstrainedType
+        { return has_value() ? _value : static_cast<ConstrainedType>(std::forward<U>(fallback)); }
+#pragma endregion observers
+
+        // Raw values are compared, empty optionals are equal
+        [[nodiscard]] constexpr auto operator==(optional const & other) const -> bool
+            requires std::equality_comparable<typename ConstrainedType::value_type>
+        {
+            if (has_value() != other.has_value())
+                return false;
+            return not has_value() or static_cast<bool>(_value._value == other._value._value);
+        }
+
+        [[nodiscard]] constexpr auto operator==(std::nullopt_t) const noexcept(noexcept(has_value())) -> bool
+        { return not has_value(); }
+
+    private:
+        using raw_type = typename ConstrainedType::value_type;
+        using niche_type = detail::niche<ConstrainedType>;
+        using unchecked_tag = typename ConstrainedType::unchecked_tag;
+
+        ConstrainedType _value;
+    };
+
+    template <constrained ConstrainedType>
+        requires (not detail::niche<ConstrainedType>::exists)
+    class optional<ConstrainedType> : public std::optional<ConstrainedType>
+    {
+    public:
+        using std::optional<ConstrainedType>::optional;
+        using std::optional<ConstrainedType>::operator=;
+    };
+
+    template <constrained ConstrainedType>
+    constexpr void swap(optional<ConstrainedType> & x, optional<ConstrainedType> & y) noexcept(noexcept(x.swap(y)))
+    { x.swap(y); }
+} // namespace ct
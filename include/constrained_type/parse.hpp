@@ -0,0 +1,319 @@
+#pragma once
+
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <constrained_type/value_pack.hpp>
+#include <constrained_type/constrained_type.hpp>
+#include <constrained_type/interval.hpp>
+#include <constrained_type/combinators/operators.hpp>
+
+namespace ct
+{
+    /*
+     * Reason of failed parse
+     * invalid_argument    - token doesn't start with a number
+     * out_of_range        - number doesn't fit T or the interval of integral constraints
+     * trailing_characters - number is followed by something else than the end of token
+     * violation           - number fails other constraint
+     */
+    enum class parse_errc
+    {
+        invalid_argument,
+        out_of_range,
+        trailing_characters,
+        violation,
+    };
+
+    struct parse_error
+    {
+        parse_errc code = parse_errc::invalid_argument;
+
+        // Offset of the failed token in the parsed buffer, or of the unexpected character for trailing_characters
+        std::size_t offset = 0;
+
+        // Index of the first failed constraint in constraint_pack for parse_errc::violation
+        std::size_t index = 0;
+
+        constexpr auto operator==(parse_error const &) const noexcept -> bool = default;
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        concept parsable_value =
+            (std::integral<T> or std::floating_point<T>)
+            and not std::same_as<T, bool>;
+
+        // Number read from the beginning of the buffer, std::from_chars_result with the value
+        template <typename T>
+        struct number_result
+        {
+            char const * ptr;
+            std::errc ec;
+            T value;
+        };
+
+        [[nodiscard]] constexpr auto is_digit(char c) noexcept -> bool
+        { return static_cast<unsigned char>(c - '0') < 10; }
+
+        [[nodiscard]] constexpr auto digit_count(std::uint64_t x) noexcept -> std::size_t
+        {
+            std::size_t result = 1;
+            while (x >= 10)
+            {
+                x /= 10;
+                ++result;
+            }
+            return result;
+        }
+
+        template <typename T>
+        [[nodiscard]] constexpr auto magnitude(T x) noexcept -> std::uint64_t
+        {
+            if constexpr (std::signed_integral<T>)
+                return x < 0 ? static_cast<std::uint64_t>(0) - static_cast<std::uint64_t>(x) : static_cast<std::uint64_t>(x);
+            else
+                return static_cast<std::uint64_t>(x);
+        }
+
+        /*
+         * Limits of integral T derived from the interval of its constraint pack
+         * Tokens longer than max digits are rejected without conversion, shorter ones are accumulated
+         * in std::uint64_t without overflow checks
+         */
+        template <typename T, auto Bounds>
+        struct parse_limits
+        {
+            static constexpr std::uint64_t positive = std::cmp_greater(Bounds.hi, 0) ? magnitude(Bounds.hi) : 0;
+            static constexpr std::uint64_t negative = std::cmp_less(Bounds.lo, 0) ? magnitude(Bounds.lo) : 0;
+            static constexpr std::size_t positive_digits = digit_count(positive);
+            static constexpr std::size_t negative_digits = digit_count(negative);
+            static constexpr bool fits =
+                positive_digits <= static_cast<std::size_t>(std::numeric_limits<std::uint64_t>::digits10)
+                and negative_digits <= static_cast<std::size_t>(std::numeric_limits<std::uint64_t>::digits10);
+        };
+
+        template <typename T, typename ConstraintPack>
+        consteval auto has_parse_limits() -> bool
+        {
+            if constexpr (interval_value<T> and sizeof(T) <= sizeof(std::uint64_t))
+            {
+                constexpr auto bounds = pack_interval<T, ConstraintPack>::value;
+                if constexpr (bounds.bounded and not bounds.empty())
+                    return parse_limits<T, bounds>::fits;
+            }
+            return false;
+        }
+
+        /*
+         * Accumulates at most MaxDigits digits, so the number never overflows
+         * Returns false if there are more digits, the rest of them is skipped like std::from_chars does
+         */
+        template <std::size_t MaxDigits>
+        constexpr auto accumulate_digits(char const *& p, char const * last, std::uint64_t & accumulated) noexcept -> bool
+        {
+            auto const end = static_cast<std::size_t>(last - p) > MaxDigits ? p + MaxDigits : last;
+            while (p != end and is_digit(*p))
+                accumulated = accumulated * 10 + static_cast<std::uint64_t>(*p++ - '0');
+
+            if (p == last or not is_digit(*p))
+                return true;
+            while (p != last and is_digit(*p))
+                ++p;
+            return false;
+        }
+
+        // Digits are checked against limits of the interval, so the value is in interval once accumulated
+        template <typename T, typename ConstraintPack>
+        constexpr auto read_bounded(char const * first, char const * last) noexcept -> number_result<T>
+        {
+            constexpr auto bounds = pack_interval<T, ConstraintPack>::value;
+            using limits = parse_limits<T, bounds>;
+
+            auto p = first;
+            bool negative = false;
+            if constexpr (std::signed_integral<T>)
+            {
+                if (p != last and *p == '-')
+                {
+                    negative = true;
+                    ++p;
+                }
+            }
+
+            auto const digits_begin = p;
+            while (p != last and *p == '0')
+                ++p;
+
+            std::uint64_t accumulated = 0;
+            bool const fits = negative
+                ? accumulate_digits<limits::negative_digits>(p, last, accumulated)
+                : accumulate_digits<limits::positive_digits>(p, last, accumulated);
+
+            if (p == digits_begin)
+                return {first, std::errc::invalid_argument, T{}};
+            if (not fits or accumulated > (negative ? limits::negative : limits::positive))
+                return {p, std::errc::result_out_of_range, T{}};
+
+            auto const value = negative
+                ? static_cast<T>(static_cast<std::make_unsigned_t<T>>(0) - static_cast<std::make_unsigned_t<T>>(accumulated))
+                : static_cast<T>(accumulated);
+            if constexpr (std::cmp_greater(bounds.lo, 0) or std::cmp_less(bounds.hi, 0))
+            {
+                if (value < bounds.lo or value > bounds.hi)
+                    return {p, std::errc::result_out_of_range, T{}};
+            }
+            return {p, std::errc{}, value};
+        }
+
+        template <constrained ConstrainedType>
+        constexpr auto read_number(char const * first, char const * last) noexcept -> number_result<typename ConstrainedType::value_type>
+        {
+            using value_t = typename ConstrainedType::value_type;
+            using pack_t = typename ConstrainedType::constraint_pack;
+            if constexpr (has_parse_limits<value_t, pack_t>())
+                return read_bounded<value_t, pack_t>(first, last);
+            else
+            {
+                value_t value{};
+                auto const [ptr, ec] = std::from_chars(first, last, value);
+                return {ptr, ec, value};
+            }
+        }
+
+        // Checks constraints, which are not guaranteed by read_number
+        template <constrained ConstrainedType>
+        constexpr auto check_number(typename ConstrainedType::value_type value) -> std::expected<ConstrainedType, violation>
+        {
+            using value_t = typename ConstrainedType::value_type;
+            using pack_t = typename ConstrainedType::constraint_pack;
+            if constexpr (has_parse_limits<value_t, pack_t>())
+            {
+                constexpr auto bounds = pack_interval<value_t, pack_t>::value;
+                return covered_access::try_make<ConstrainedType>(value_pack<ct::in_range<bounds.lo, bounds.hi>>{}, value);
+            }
+            else
+                return ConstrainedType::try_make(value);
+        }
+
+        [[nodiscard]] constexpr auto to_parse_errc(std::errc ec) noexcept -> parse_errc
+        { return ec == std::errc::result_out_of_range ? parse_errc::out_of_range : parse_errc::invalid_argument; }
+
+        [[nodiscard]] constexpr auto is_separator(char c, char delimiter) noexcept -> bool
+        { return c == delimiter or c == '\n' or c == '\r'; }
+
+        [[nodiscard]] constexpr auto has_separator(char const * first, char const * last, char delimiter) noexcept -> bool
+        {
+            for (; first != last; ++first)
+            {
+                if (is_separator(*first, delimiter))
+                    return true;
+            }
+            return false;
+        }
+    } // namespace detail
+
+    /*
+     * Parses the whole text as a number and checks constraints in one pass
+     * Number format is the one of std::from_chars: no leading whitespace or '+', decimal integers
+     * If constraints bound integral T to an interval, digit count and range limits are derived at compile time,
+     * so out-of-range tokens are rejected before conversion and interval constraints are not checked again
+     */
+    template <constrained ConstrainedType>
+        requires detail::parsable_value<typename ConstrainedType::value_type>
+    [[nodiscard]] constexpr auto parse(std::string_view text) -> std::expected<ConstrainedType, parse_error>
+    {
+        auto const first = text.data();
+        auto const last = first + text.size();
+        auto const [ptr, ec, number] = detail::read_number<ConstrainedType>(first, last);
+        if (ec != std::errc{})
+            return std::unexpected{parse_error{detail::to_parse_errc(ec)}};
+        if (ptr != last)
+            return std::unexpected{parse_error{parse_errc::trailing_characters, static_cast<std::size_t>(ptr - first)}};
+
+        auto result = detail::check_number<ConstrainedType>(number);
+        if (not result)
+            return std::unexpected{parse_error{parse_errc::violation, 0, result.error().index}};
+        return std::move(*result);
+    }
+
+    template <typename OutputIterator>
+    struct parse_many_result
+    {
+        OutputIterator out;
+
+        // Number of parsed values
+        std::size_t count = 0;
+
+        // Number of consumed characters, the rest starts with failed or incomplete token
+        std::size_t consumed = 0;
+
+        std::optional<parse_error> error;
+    };
+
+    /*
+     * Parses values separated by delimiter or line breaks and writes them to out until the first error
+     * Empty tokens are skipped, so "1,2\r\n3" is three values
+     * If final_chunk is false, the last token without trailing separator may be cut by the end of buffer,
+     * so it's left unconsumed to be parsed with the next chunk
+     */
+    template <constrained ConstrainedType, std::output_iterator<ConstrainedType> OutputIterator>
+        requires detail::parsable_value<typename ConstrainedType::value_type>
+    constexpr auto parse_many(
+        std::string_view buffer,
+        OutputIterator out,
+        char delimiter = ',',
+        bool final_chunk = true
+    ) -> parse_many_result<OutputIterator>
+    {
+        auto const first = buffer.data();
+        auto const last = first + buffer.size();
+        std::size_t count = 0;
+
+        auto p = first;
+        while (true)
+        {
+            while (p != last and detail::is_separator(*p, delimiter))
+                ++p;
+            if (p == last)
+                break;
+
+            auto const offset = static_cast<std::size_t>(p - first);
+            // Any prefix of the last token may be completed by the next chunk, e.g. "-" by "12" or "2e" by "5"
+            if (not final_chunk and not detail::has_separator(p, last, delimiter))
+                return {std::move(out), count, offset, std::nullopt};
+
+            auto const [ptr, ec, number] = detail::read_number<ConstrainedType>(p, last);
+            if (ec != std::errc{})
+                return {std::move(out), count, offset, parse_error{detail::to_parse_errc(ec), offset}};
+            if (ptr != last and not detail::is_separator(*ptr, delimiter))
+            {
+                return {
+                    std::move(out), count, offset,
+                    parse_error{parse_errc::trailing_characters, static_cast<std::size_t>(ptr - first)}
+                };
+            }
+
+            auto value = detail::check_number<ConstrainedType>(number);
+            if (not value)
+                return {std::move(out), count, offset, parse_error{parse_errc::violation, offset, value.error().index}};
+
+            *out = std::move(*value);
+            ++out;
+            ++count;
+            p = ptr;
+        }
+        return {std::move(out), count, buffer.size(), std::nullopt};
+    }
+} // namespace ct
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#include <constrained_type/normalize.hpp>
+#include <constrained_type/combinators/operators.hpp>
+
+// GCC and Clang vector extensions are used to express SIMD kernels portably
+#if defined(__GNUC__)
+    #define CONSTRAINED_TYPE_VECTOR_KERNELS 1
+    #if defined(__x86_64__) || defined(__i386__)
+        #define CONSTRAINED_TYPE_AVX2_DISPATCH 1
+    #endif
+#endif
+
+namespace ct
+{
+    namespace detail
+    {
+        template <typename T>
+        concept simd_element =
+            std::is_arithmetic_v<T>
+            and not std::same_as<T, bool>
+            and (sizeof(T) == 1 or sizeof(T) == 2 or sizeof(T) == 4 or sizeof(T) == 8);
+
+        /*
+         * Maps combinator type to its vector form
+         * Specializations provide eval(x, mask), which stores lane-wise result of the combinator
+         * Combinators without specialization are evaluated by scalar code
+         */
+        template <typename Combinator, typename T>
+        struct simd_lowering
+        {
+            static constexpr bool value = false;
+        };
+
+#define CONSTRAINED_TYPE_SIMD_RELATIONAL_LOWERING(name, op) \
+        template <auto A, typename T> \
+            requires (is_exact_constant<T, A>()) \
+        struct simd_lowering<name<A>, T> \
+        { \
+            static constexpr bool value = true; \
+            \
+            template <typename Vec, typename Mask> \
+            [[gnu::always_inline]] static constexpr void eval(Vec const & x, Mask & mask) noexcept \
+            { mask = x op static_cast<T>(A); } \
+        };
+
+// Vectors are passed by reference only: by-value AVX vectors change the ABI of non-AVX functions
+#define CONSTRAINED_TYPE_SIMD_LOGICAL_LOWERING(name, op, identity) \
+        template <auto... Args, typename T> \
+            requires (sizeof...(Args) > 1) \
+                and (simd_lowering<std::remove_cv_t<decltype(Args)>, T>::value && ...) \
+        struct simd_lowering<name<Args...>, T> \
+        { \
+            static constexpr bool value = true; \
+            \
+            template <typename Vec, typename Mask> \
+            [[gnu::always_inline]] static constexpr void eval(Vec const & x, Mask & mask) noexcept \
+            { \
+                mask = identity; \
+                ([&x, &mask]{ \
+                    Mask m; \
+                    simd_lowering<std::remove_cv_t<decltype(Args)>, T>::eval(x, m); \
+                    mask op##= m; \
+                }(), ...); \
+            } \
+        };
+
+        CONSTRAINED_TYPE_SIMD_RELATIONAL_LOWERING(eq,  ==)
+        CONSTRAINED_TYPE_SIMD_RELATIONAL_LOWERING(neq, !=)
+        CONSTRAINED_TYPE_SIMD_RELATIONAL_LOWERING(gt,   >)
+        CONSTRAINED_TYPE_SIMD_RELATIONAL_LOWERING(ge,  >=)
+        CONSTRAINED_TYPE_SIMD_RELATIONAL_LOWERING(lt,   <)
+        CONSTRAINED_TYPE_SIMD_RELATIONAL_LOWERING(le,  <=)
+
+        CONSTRAINED_TYPE_SIMD_LOGICAL_LOWERING(and_, &, ~Mask{})
+        CONSTRAINED_TYPE_SIMD_LOGICAL_LOWERING(or_,  |,  Mask{})
+        CONSTRAINED_TYPE_SIMD_LOGICAL_LOWERING(branchless_and, &, ~Mask{})
+        CONSTRAINED_TYPE_SIMD_LOGICAL_LOWERING(branchless_or,  |,  Mask{})
+
+#undef CONSTRAINED_TYPE_SIMD_RELATIONAL_LOWERING
+#undef CONSTRAINED_TYPE_SIMD_LOGICAL_LOWERING
+
+        template <auto A, typename T>
+            requires simd_lowering<std::remove_cv_t<decltype(A)>, T>::value
+        struct simd_lowering<not_<A>, T>
+        {
+            static constexpr bool value = true;
+
+            template <typename Vec, typename Mask>
+            [[gnu::always_inline]] static constexpr void eval(Vec const & x, Mask & mask) noexcept
+            {
+                simd_lowering<std::remove_cv_t<decltype(A)>, T>::eval(x, mask);
+                mask = ~mask;
+            }
+        };
+
+        template <auto Lo, auto Hi, typename T>
+            requires (is_exact_constant<T, Lo>() and is_exact_constant<T, Hi>())
+        struct simd_lowering<in_range<Lo, Hi>, T>
+        {
+            static constexpr bool value = true;
+
+            template <typename Vec, typename Mask>
+            [[gnu::always_inline]] static constexpr void eval(Vec const & x, Mask & mask) noexcept
+            { mask = (x >= static_cast<T>(Lo)) & (x <= static_cast<T>(Hi)); }
+        };
+
+        // Small sets are compared lane-wise with every value
+        inline constexpr std::size_t max_simd_set = 8;
+
+        template <auto... Values, typename T>
+            requires (sizeof...(Values) <= max_simd_set)
+                and (is_exact_constant<T, Values>() && ...)
+        struct simd_lowering<one_of<Values...>, T>
+        {
+            static constexpr bool value = true;
+
+            template <typename Vec, typename Mask>
+            [[gnu::always_inline]] static constexpr void eval(Vec const & x, Mask & mask) noexcept
+            {
+                mask = Mask{};
+                ((mask |= x == static_cast<T>(Values)), ...);
+            }
+        };
+
+#if defined(CONSTRAINED_TYPE_VECTOR_KERNELS)
+        template <typename T, std::size_t Bytes>
+        struct simd_vector
+        {
+            using type [[gnu::vector_size(Bytes)]] = T;
+        };
+#endif
+    } // namespace detail
+} // namespace ct
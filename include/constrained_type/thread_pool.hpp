@@ -0,0 +1,251 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ct
+{
+    namespace detail::parallel
+    {
+        /*
+         * Work-stealing pool for range checks
+         *
+         * A job is split into chunks, every participant (caller and workers) owns a contiguous range of chunks
+         * and takes chunks from its front. Participant without work steals the back half of another range.
+         * Job is cancelled as soon as any chunk fails, remaining chunks are skipped.
+         *
+         * Only one job runs at a time. If pool is busy (concurrent or nested call) run() returns nullopt
+         * and caller checks the range by itself, so the pool never deadlocks.
+         */
+        class pool
+        {
+        public:
+            using chunk_function = auto (*)(void * body, std::size_t first, std::size_t last) -> bool;
+
+            [[nodiscard]] static auto instance() -> pool &
+            {
+                static pool p{std::max<std::size_t>(std::thread::hardware_concurrency(), 1)};
+                return p;
+            }
+
+            pool(pool const &) = delete;
+            auto operator=(pool const &) -> pool & = delete;
+
+            ~pool()
+            { stop(); }
+
+            // Number of threads checking a job, including the caller
+            [[nodiscard]] auto concurrency() const noexcept -> std::size_t
+            { return _concurrency.load(std::memory_order_relaxed); }
+
+            // Waits for the running job to finish
+            void resize(std::size_t threads)
+            {
+                std::scoped_lock lock{_submit};
+                stop();
+                start(std::max<std::size_t>(threads, 1));
+            }
+
+            /*
+             * Calls body(first, last) for chunks of [0, size) of grain elements on the caller and worker threads
+             * Returns false if any call returned false, exceptions thrown by body are rethrown to the caller
+             */
+            template <typename Body>
+            [[nodiscard]] auto run(std::size_t size, std::size_t grain, Body & body) -> std::optional<bool>
+            {
+                return run(size, grain, [](void * b, std::size_t first, std::size_t last) -> bool {
+                    return (*static_cast<Body *>(b))(first, last);
+                }, &body);
+            }
+
+        private:
+            struct alignas(64) slot
+            {
+                // Chunk range [begin, end), begin in the high half
+                std::atomic<std::uint64_t> range{0};
+            };
+
+            static constexpr auto pack(std::uint64_t begin, std::uint64_t end) noexcept -> std::uint64_t
+            { return begin << 32 | end; }
+
+            static constexpr auto begin_of(std::uint64_t range) noexcept -> std::uint64_t
+            { return range >> 32; }
+
+            static constexpr auto end_of(std::uint64_t range) noexcept -> std::uint64_t
+            { return range & 0xFFFF'FFFF; }
+
+            std::mutex _submit;
+            std::vector<std::thread> _workers;
+            std::unique_ptr<slot[]> _slots;
+            std::atomic<std::size_t> _concurrency{1};
+
+            // Current job
+            chunk_function _function = nullptr;
+            void * _body = nullptr;
+            std::size_t _size = 0;
+            std::size_t _grain = 0;
+            std::atomic<bool> _cancelled{false};
+            std::atomic<bool> _failed{false};
+            std::mutex _error_mutex;
+            std::exception_ptr _error;
+
+            std::atomic<std::uint64_t> _generation{0};
+            std::atomic<std::size_t> _pending{0};
+            std::atomic<bool> _stopping{false};
+
+            explicit pool(std::size_t threads)
+            { start(threads); }
+
+            void start(std::size_t threads)
+            {
+                _slots = std::make_unique<slot[]>(threads);
+                _concurrency.store(threads, std::memory_order_relaxed);
+                auto const generation = _generation.load(std::memory_order_relaxed);
+                for (std::size_t i = 1; i < threads; ++i)
+                    _workers.emplace_back([this, i, generation]{ work(i, generation); });
+            }
+
+            void stop()
+            {
+                _stopping.store(true, std::memory_order_release);
+                _generation.fetch_add(1, std::memory_order_release);
+                _generation.notify_all();
+                for (auto & worker : _workers)
+                    worker.join();
+                _workers.clear();
+                _stopping.store(false, std::memory_order_relaxed);
+            }
+
+            void work(std::size_t index, std::uint64_t seen)
+            {
+                while (true)
+                {
+                    _generation.wait(seen, std::memory_order_acquire);
+                    seen = _generation.load(std::memory_order_acquire);
+                    if (_stopping.load(std::memory_order_acquire))
+                        return;
+
+                    participate(index);
+                    if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        _pending.notify_one();
+                }
+            }
+
+            auto run(std::size_t size, std::size_t grain, chunk_function function, void * body) -> std::optional<bool>
+            {
+                std::unique_lock lock{_submit, std::try_to_lock};
+                if (not lock.owns_lock() or _workers.empty())
+                    return std::nullopt;
+
+                grain = std::max<std::size_t>(grain, 1);
+                std::size_t const chunks = (size + grain - 1) / grain;
+                std::size_t const participants = _workers.size() + 1;
+                if (chunks > 0xFFFF'FFFF)
+                    return std::nullopt;
+
+                for (std::size_t p = 0; p < participants; ++p)
+                    _slots[p].range.store(pack(chunks * p / participants, chunks * (p + 1) / participants), std::memory_order_relaxed);
+
+                _function = function;
+                _body = body;
+                _size = size;
+                _grain = grain;
+                _cancelled.store(false, std::memory_order_relaxed);
+                _failed.store(false, std::memory_order_relaxed);
+                _error = nullptr;
+
+                _pending.store(_workers.size(), std::memory_order_relaxed);
+                _generation.fetch_add(1, std::memory_order_release);
+                _generation.notify_all();
+
+                participate(0);
+
+                for (auto n = _pending.load(std::memory_order_acquire); n != 0; n = _pending.load(std::memory_order_acquire))
+                    _pending.wait(n, std::memory_order_acquire);
+
+                if (_error)
+                    std::rethrow_exception(std::exchange(_error, nullptr));
+                return not _failed.load(std::memory_order_relaxed);
+            }
+
+            void participate(std::size_t index)
+            {
+                while (not _cancelled.load(std::memory_order_relaxed))
+                {
+                    auto const chunk = take(index);
+                    if (not chunk)
+                        return;
+
+                    std::size_t const first = *chunk * _grain;
+                    std::size_t const last = std::min(_size, first + _grain);
+                    try
+                    {
+                        if (not _function(_body, first, last))
+                        {
+                            _failed.store(true, std::memory_order_relaxed);
+                            _cancelled.store(true, std::memory_order_relaxed);
+                        }
+                    }
+                    catch (...)
+                    {
+                        std::scoped_lock lock{_error_mutex};
+                        if (not _error)
+                            _error = std::current_exception();
+                        _cancelled.store(true, std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            // Next chunk of own range, or the first chunk of stolen half of another range
+            auto take(std::size_t index) -> std::optional<std::uint64_t>
+            {
+                auto & own = _slots[index].range;
+                auto range = own.load(std::memory_order_acquire);
+                while (begin_of(range) < end_of(range))
+                {
+                    if (own.compare_exchange_weak(range, pack(begin_of(range) + 1, end_of(range)), std::memory_order_acq_rel))
+                        return begin_of(range);
+                }
+
+                std::size_t const participants = _workers.size() + 1;
+                for (std::size_t k = 1; k < participants; ++k)
+                {
+                    auto & victim = _slots[(index + k) % participants].range;
+                    auto stolen = victim.load(std::memory_order_acquire);
+                    while (begin_of(stolen) < end_of(stolen))
+                    {
+                        auto const begin = begin_of(stolen);
+                        auto const end = end_of(stolen);
+                        auto const middle = begin + (end - begin) / 2;
+                        if (victim.compare_exchange_weak(stolen, pack(begin, middle), std::memory_order_acq_rel))
+                        {
+                            own.store(pack(middle + 1, end), std::memory_order_release);
+                            return middle;
+                        }
+                    }
+                }
+                return std::nullopt;
+            }
+        };
+    } // namespace detail::parallel
+
+    /*
+     * Sets number of threads checking large ranges, including the calling thread
+     * 1 disables parallel checks. Default is std::thread::hardware_concurrency()
+     */
+    inline void set_parallel_concurrency(std::size_t threads)
+    { detail::parallel::pool::instance().resize(threads); }
+
+    [[nodiscard]] inline auto parallel_concurrency() -> std::size_t
+    { return detail::parallel::pool::instance().concurrency(); }
+} // namespace ct
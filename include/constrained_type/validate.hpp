@@ -0,0 +1,269 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <constrained_type/value_pack.hpp>
+#include <constrained_type/constrained_type.hpp>
+#include <constrained_type/normalize.hpp>
+#include <constrained_type/simd.hpp>
+#include <constrained_type/combinators/operators.hpp>
+
+namespace ct
+{
+    /*
+     * Result of bulk validation. Bit i is set if values[i] failed constraints
+     */
+    class validation_mask
+    {
+    public:
+        static constexpr std::size_t word_bits = 64;
+
+        validation_mask() = default;
+
+        explicit validation_mask(std::size_t size)
+            : _words((size + word_bits - 1) / word_bits)
+            , _size{size}
+        {}
+
+        [[nodiscard]] auto size() const noexcept -> std::size_t
+        { return _size; }
+
+        [[nodiscard]] auto failed(std::size_t i) const noexcept -> bool
+        { return (_words[i / word_bits] >> (i % word_bits)) & 1U; }
+
+        [[nodiscard]] auto failures() const noexcept -> std::size_t
+        {
+            std::size_t count = 0;
+            for (auto word : _words)
+                count += static_cast<std::size_t>(std::popcount(word));
+            return count;
+        }
+
+        [[nodiscard]] auto words() const noexcept -> std::span<const std::uint64_t>
+        { return _words; }
+
+        [[nodiscard]] auto words() noexcept -> std::span<std::uint64_t>
+        { return _words; }
+
+    private:
+        std::vector<std::uint64_t> _words;
+        std::size_t _size = 0;
+    };
+
+    namespace detail
+    {
+        /*
+         * Computes failure bits of values in chunks of 64 elements
+         * Vector kernels are used if every constraint has simd_lowering, scalar fold otherwise
+         */
+        template <typename T, auto... Constraints>
+        struct bulk_kernel
+        {
+            static constexpr std::size_t chunk_size = validation_mask::word_bits;
+
+            static constexpr bool vectorized =
+#if defined(CONSTRAINED_TYPE_VECTOR_KERNELS)
+                simd_element<T>
+                and (simd_lowering<std::remove_cv_t<decltype(Constraints)>, T>::value && ...);
+#else
+                false;
+#endif
+
+            static constexpr bool nothrow =
+                (nothrow_predicate<decltype(Constraints), T const &> && ...);
+
+            using chunk_function = auto (*)(T const *) -> std::uint64_t;
+
+            // Handles tails and packs that can't be vectorized
+            [[nodiscard]] static constexpr auto scalar(T const * values, std::size_t n)
+                noexcept(nothrow) -> std::uint64_t
+            {
+                std::uint64_t bits = 0;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    bool const satisfied = (std::invoke(Constraints, values[i]) && ...);
+                    bits |= static_cast<std::uint64_t>(not satisfied) << i;
+                }
+                return bits;
+            }
+
+            [[nodiscard]] static auto scalar_chunk(T const * values) noexcept(nothrow) -> std::uint64_t
+            { return scalar(values, chunk_size); }
+
+#if defined(CONSTRAINED_TYPE_VECTOR_KERNELS)
+            template <std::size_t Bytes>
+            [[nodiscard]] [[gnu::always_inline]] static auto vector_chunk(T const * values) noexcept -> std::uint64_t
+            {
+                using vec = typename simd_vector<T, Bytes>::type;
+                using mask = decltype(std::declval<vec>() == std::declval<vec>());
+                constexpr std::size_t lanes = Bytes / sizeof(T);
+
+                std::uint64_t bits = 0;
+                for (std::size_t i = 0; i < chunk_size; i += lanes)
+                {
+                    vec x;
+                    std::memcpy(&x, values + i, sizeof(x));
+
+                    mask satisfied = ~mask{};
+                    ((
+                        [&x, &satisfied]{
+                            mask m;
+                            simd_lowering<std::remove_cv_t<decltype(Constraints)>, T>::eval(x, m);
+                            satisfied &= m;
+                        }()
+                    ), ...);
+
+                    for (std::size_t lane = 0; lane < lanes; ++lane)
+                        bits |= static_cast<std::uint64_t>(satisfied[lane] == 0) << (i + lane);
+                }
+                return bits;
+            }
+
+            [[nodiscard]] static auto sse2_chunk(T const * values) noexcept -> std::uint64_t
+            { return vector_chunk<16>(values); }
+
+    #if defined(CONSTRAINED_TYPE_AVX2_DISPATCH)
+            [[nodiscard]] [[gnu::target("avx2")]] static auto avx2_chunk(T const * values) noexcept -> std::uint64_t
+            { return vector_chunk<32>(values); }
+    #endif
+#endif
+
+            // Picks the widest kernel supported by current CPU
+            [[nodiscard]] static auto select() noexcept -> chunk_function
+            {
+                if constexpr (vectorized)
+                {
+#if defined(CONSTRAINED_TYPE_AVX2_DISPATCH)
+                    if (__builtin_cpu_supports("avx2"))
+                        return &avx2_chunk;
+#endif
+#if defined(CONSTRAINED_TYPE_VECTOR_KERNELS)
+                    return &sse2_chunk;
+#endif
+                }
+                return &scalar_chunk;
+            }
+
+            /*
+             * Calls f(offset, bits) for every chunk of values
+             * f returns false to stop iteration
+             */
+            static void for_each_chunk(std::span<T const> values, auto && f) noexcept(nothrow)
+            {
+                auto const chunk = select();
+                std::size_t const full = values.size() - values.size() % chunk_size;
+
+                std::size_t offset = 0;
+                for (; offset < full; offset += chunk_size)
+                {
+                    if (not f(offset, chunk(values.data() + offset)))
+                        return;
+                }
+                if (offset < values.size())
+                    f(offset, scalar(values.data() + offset, values.size() - offset));
+            }
+        };
+
+        template <typename T, typename ConstraintPack>
+        struct bulk_kernel_of;
+
+        template <typename T, auto... Constraints>
+        struct bulk_kernel_of<T, value_pack<Constraints...>>
+        {
+            using type = bulk_kernel<T, Constraints...>;
+        };
+
+        template <constrained ConstrainedType>
+        using bulk_kernel_for = typename bulk_kernel_of<
+            typename ConstrainedType::value_type,
+            typename ConstrainedType::constraint_pack
+        >::type;
+    } // namespace detail
+
+    /*
+     * Checks if constraints of ConstrainedType can be evaluated by SIMD kernels
+     */
+    template <constrained ConstrainedType>
+    inline constexpr bool is_vectorized = detail::bulk_kernel_for<ConstrainedType>::vectorized;
+
+    /*
+     * Validates values against constraints of ConstrainedType without constructing it
+     * Returns bitmask of failed elements
+     */
+    template <constrained ConstrainedType>
+    [[nodiscard]] auto validate(std::span<typename ConstrainedType::value_type const> values)
+        -> validation_mask
+    {
+        using kernel = detail::bulk_kernel_for<ConstrainedType>;
+
+        validation_mask mask{values.size()};
+        auto words = mask.words();
+        kernel::for_each_chunk(values, [&words](std::size_t offset, std::uint64_t bits) {
+            words[offset / kernel::chunk_size] = bits;
+            return true;
+        });
+        return mask;
+    }
+
+    /*
+     * Returns index of the first value failing constraints of ConstrainedType or values.size()
+     */
+    template <constrained ConstrainedType>
+    [[nodiscard]] auto validate_first(std::span<typename ConstrainedType::value_type const> values)
+        noexcept(detail::bulk_kernel_for<ConstrainedType>::nothrow)
+        -> std::size_t
+    {
+        using kernel = detail::bulk_kernel_for<ConstrainedType>;
+
+        std::size_t index = values.size();
+        kernel::for_each_chunk(values, [&index](std::size_t offset, std::uint64_t bits) {
+            if (bits == 0)
+                return true;
+            index = offset + static_cast<std::size_t>(std::countr_zero(bits));
+            return false;
+        });
+        return index;
+    }
+
+    /*
+     * Moves values satisfying constraints of ConstrainedType to the front keeping their relative order
+     * Returns amount of such values
+     */
+    template <constrained ConstrainedType>
+    auto validate_partition(std::span<typename ConstrainedType::value_type> values)
+        noexcept(
+            detail::bulk_kernel_for<ConstrainedType>::nothrow
+            and std::is_nothrow_swappable_v<typename ConstrainedType::value_type>
+        )
+        -> std::size_t
+    {
+        using kernel = detail::bulk_kernel_for<ConstrainedType>;
+        using std::swap;
+
+        // Swaps only touch already inspected positions, so later chunks are read unmodified
+        std::size_t valid = 0;
+        kernel::for_each_chunk(values, [&values, &valid](std::size_t offset, std::uint64_t bits) {
+            std::size_t const n = std::min(kernel::chunk_size, values.size() - offset);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if ((bits >> i) & 1U)
+                    continue;
+                if (valid != offset + i)
+                    swap(values[valid], values[offset + i]);
+                ++valid;
+            }
+            return true;
+        });
+        return valid;
+    }
+} // namespace ct
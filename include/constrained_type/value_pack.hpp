@@ -3,10 +3,40 @@
 #include <concepts>
 #include <cstddef>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace ct
 {
+    template <auto... Xs>
+    struct value_pack;
+
+    namespace detail
+    {
+        // Doesn't touch members of value_pack, so it can be used while value_pack is incomplete
+        template <typename Seen, auto... Ys>
+        struct unique_values;
+
+        template <auto... Seen>
+        struct unique_values<value_pack<Seen...>>
+        {
+            using type = value_pack<Seen...>;
+        };
+
+        template <auto... Seen, auto Y, auto... Ys>
+        struct unique_values<value_pack<Seen...>, Y, Ys...>
+        {
+            using type = typename unique_values<
+                std::conditional_t<
+                    (std::same_as<value_pack<Y>, value_pack<Seen>> || ...),
+                    value_pack<Seen...>,
+                    value_pack<Seen..., Y>
+                >,
+                Ys...
+            >::type;
+        };
+    }
+
     template <auto... Xs>
     struct value_pack final
     {
@@ -80,5 +110,99 @@ namespace ct
         using get_range = decltype(
             get_range_impl<Start>(std::make_index_sequence<Len>{})
         );
+
+    private:
+        template <auto Y>
+        static constexpr bool contains_one = (std::same_as<value_pack<Y>, value_pack<Xs>> || ...);
+    public:
+        /*
+         * Check if every of Ys is in current pack
+         * Values are compared as template arguments, so each lambda is distinct from others
+         * value_pack<1, 2, 3>::contains<3, 1> <=> true
+         */
+        template <auto... Ys>
+        static constexpr bool contains = (contains_one<Ys> && ...);
+
+    private:
+        template <auto... Ys>
+        static consteval auto contains_pack_impl(value_pack<Ys...>*) -> bool
+        { return contains<Ys...>; }
+    public:
+        /*
+         * Check if every value of Pack is in current pack
+         * value_pack<1, 2, 3>::contains_pack<value_pack<3, 1>> <=> true
+         */
+        template <typename Pack>
+        static constexpr bool contains_pack = contains_pack_impl(static_cast<Pack*>(nullptr));
+
+    private:
+        template <bool Keep, typename Pack, auto Y, auto... Ys>
+        static consteval auto filter_impl()
+        {
+            using head = std::conditional_t<Pack::template contains<Y> == Keep, value_pack<Y>, value_pack<>>;
+            if constexpr (sizeof...(Ys) == 0)
+                return head{};
+            else
+                return typename head::template add_pack<decltype(filter_impl<Keep, Pack, Ys...>())>{};
+        }
+
+        template <bool Keep, typename Pack>
+        static consteval auto filter()
+        {
+            if constexpr (size == 0)
+                return value_pack<>{};
+            else
+                return filter_impl<Keep, Pack, Xs...>();
+        }
+    public:
+        /*
+         * Remove values of Pack from current pack keeping order of the rest
+         * value_pack<1, 2, 3, 2>::remove_pack<value_pack<2>> <=> value_pack<1, 3>
+         */
+        template <typename Pack>
+        using remove_pack = decltype(filter<false, Pack>());
+
+        /*
+         * Remove Ys from current pack keeping order of the rest
+         * value_pack<1, 2, 3, 2>::remove<2> <=> value_pack<1, 3>
+         */
+        template <auto... Ys>
+        using remove = remove_pack<value_pack<Ys...>>;
+
+        /*
+         * Keep only values of current pack, which are in Pack
+         * value_pack<1, 2, 3>::intersect_pack<value_pack<3, 1, 4>> <=> value_pack<1, 3>
+         */
+        template <typename Pack>
+        using intersect_pack = decltype(filter<true, Pack>());
+
+        /*
+         * Keep only values of current pack, which are in Ys
+         * value_pack<1, 2, 3>::intersect<3, 1, 4> <=> value_pack<1, 3>
+         */
+        template <auto... Ys>
+        using intersect = intersect_pack<value_pack<Ys...>>;
+
+    private:
+        template <auto Y>
+        static consteval auto index_of_impl() -> std::size_t
+        {
+            std::size_t index = 0;
+            static_cast<void>(((std::same_as<value_pack<Y>, value_pack<Xs>> ? false : (++index, true)) && ...));
+            return index;
+        }
+    public:
+        /*
+         * Index of the first occurence of Y or size if there is no Y in current pack
+         * value_pack<1, 2, 3, 2>::index_of<2> <=> 1
+         */
+        template <auto Y>
+        static constexpr std::size_t index_of = index_of_impl<Y>();
+
+        /*
+         * Remove duplicates keeping the first occurence of each value
+         * value_pack<1, 2, 1, 3, 2>::unique <=> value_pack<1, 2, 3>
+         */
+        using unique = typename detail::unique_values<value_pack<>, Xs...>::type;
     };
 } // namespace ct
\ No newline at end of file
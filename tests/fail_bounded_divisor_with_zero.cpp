@@ -0,0 +1,11 @@
+#include <constrained_type.hpp>
+
+// Divisor interval [-1, 1] contains zero
+using percent_t = ct::bounded<int, 0, 100>;
+using divisor_t = ct::bounded<int, -1, 1>;
+
+auto main() -> int
+{
+    auto const quotient = percent_t{50} / divisor_t{1};
+    return *quotient > 0;
+}
@@ -0,0 +1,13 @@
+#include <limits>
+
+#include <constrained_type.hpp>
+
+// [max - 10, max] + [0, 20] may not fit in int
+using large_t = ct::bounded<int, std::numeric_limits<int>::max() - 10, std::numeric_limits<int>::max()>;
+using step_t = ct::bounded<int, 0, 20>;
+
+auto main() -> int
+{
+    auto const sum = large_t{std::numeric_limits<int>::max()} + step_t{1};
+    return *sum > 0;
+}
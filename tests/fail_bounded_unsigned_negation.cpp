@@ -0,0 +1,10 @@
+#include <constrained_type.hpp>
+
+// Negation of unsigned [1, 10] is out of unsigned range
+using count_t = ct::bounded<unsigned, 1u, 10u>;
+
+auto main() -> int
+{
+    auto const negated = -count_t{5u};
+    return *negated > 0;
+}
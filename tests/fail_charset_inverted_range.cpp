@@ -0,0 +1,12 @@
+#include <string>
+
+#include <constrained_type.hpp>
+
+// "a-z" is inverted range, it must be rejected instead of denoting an empty set
+using name_t = ct::constrained_type<std::string, ct::charset<"z-a">>;
+
+auto main() -> int
+{
+    name_t name{"a"};
+    return name->empty();
+}
@@ -0,0 +1,11 @@
+#include <constrained_type.hpp>
+
+using port_t = ct::constrained_type<int, ct::gt<0>, ct::le<65535>>;
+
+// 0 fails gt<0>
+static constexpr auto invalid = port_t::from_constant<0>();
+
+auto main() -> int
+{
+    return *invalid;
+}
@@ -0,0 +1,10 @@
+#include <constrained_type.hpp>
+
+// eq<3> conflicts with the lower bound gt<5>
+using conflicting_t = ct::constrained_type<int, ct::gt<5>, ct::eq<3>>::normalize_constraints;
+
+auto main() -> int
+{
+    conflicting_t const value{3};
+    return *value;
+}
@@ -0,0 +1,10 @@
+#include <constrained_type.hpp>
+
+// No int is in (5, 6)
+using empty_t = ct::constrained_type<int, ct::gt<5>, ct::lt<6>>::normalize_constraints;
+
+auto main() -> int
+{
+    empty_t const value{5};
+    return *value;
+}
@@ -0,0 +1,13 @@
+#include <array>
+
+#include <constrained_type.hpp>
+
+using port_t = ct::constrained_type<int, ct::gt<0>, ct::le<65535>>;
+
+// Element number 2 fails le<65535>
+static constexpr auto routes = ct::make_static_table<port_t, std::array{80, 443, 70000}>();
+
+auto main() -> int
+{
+    return *routes[0];
+}
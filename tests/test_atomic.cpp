@@ -0,0 +1,102 @@
+#include <cassert>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <constrained_type.hpp>
+
+struct nullable_int_traits
+{
+    using value_type = int;
+    static constexpr bool is_nullable = true;
+    static constexpr int null = 0;
+};
+
+using limit_t = ct::constrained_type<int, ct::in_range<1, 1000>>;
+using nullable_limit_t = ct::basic_constrained_type<int, nullable_int_traits, ct::configuration_point{}, ct::in_range<1, 1000>>;
+
+// Failure order is the strongest one allowed for the success order
+static_assert(ct::detail::failure_order(std::memory_order_seq_cst) == std::memory_order_seq_cst);
+static_assert(ct::detail::failure_order(std::memory_order_acq_rel) == std::memory_order_acquire);
+static_assert(ct::detail::failure_order(std::memory_order_acquire) == std::memory_order_acquire);
+static_assert(ct::detail::failure_order(std::memory_order_release) == std::memory_order_relaxed);
+static_assert(ct::detail::failure_order(std::memory_order_relaxed) == std::memory_order_relaxed);
+
+template <typename C>
+void check_failed_candidates()
+{
+    ct::atomic<C> value{C{100}};
+
+    // Raw candidate failing the check is reported and never reaches CAS
+    auto expected = C{100};
+    auto const exchanged = value.compare_exchange(expected, 5000);
+    assert(not exchanged and exchanged.error().index == 0);
+    assert(*value.load() == 100 and *expected == 100);
+
+    // Failed CAS reports the current value
+    expected = C{1};
+    assert(not value.compare_exchange_strong(expected, C{2}));
+    assert(*expected == 100 and *value.load() == 100);
+    expected = C{1};
+    while (*expected != 100)
+        assert(not value.compare_exchange_weak(expected, C{2}, std::memory_order_acq_rel));
+    assert(*value.load() == 100);
+
+    auto const previous = value.fetch_update([](C const & x) { return *x * 20; });
+    assert(not previous and previous.error().index == 0);
+    assert(*value.load() == 100);
+
+    // Successful exchanges
+    assert(value.compare_exchange(expected, 200).value());
+    assert(*value.load() == 200);
+    auto const doubled = value.fetch_update([](C const & x) { return *x * 2; }, std::memory_order_release);
+    assert(doubled and **doubled == 200);
+    assert(*value.load() == 400);
+    auto const same = value.fetch_update([](C const & x) { return x; });
+    assert(same and **same == 400 and *value.load() == 400);
+}
+
+void check_concurrent_updates()
+{
+    constexpr int threads = 4;
+    constexpr int iterations = 10000;
+
+    ct::atomic<limit_t> value{limit_t{1}};
+    std::atomic<int> rejected{0};
+    std::atomic<bool> invalid_seen{false};
+    {
+        std::vector<std::jthread> workers;
+        for (int t = 0; t < threads; ++t)
+            workers.emplace_back([&] {
+                for (int i = 0; i < iterations; ++i)
+                {
+                    // Steps over the upper bound are rejected, so some updates fail
+                    auto const previous = value.fetch_update([](limit_t const & x) { return *x + 7; });
+                    if (not previous)
+                    {
+                        rejected.fetch_add(1, std::memory_order_relaxed);
+                        value.store(limit_t{1});
+                    }
+                    auto const current = *value.load();
+                    if (current < 1 or current > 1000)
+                        invalid_seen.store(true, std::memory_order_relaxed);
+                }
+            });
+    }
+
+    assert(not invalid_seen.load());
+    assert(rejected.load() > 0);
+    auto const last = *value.load();
+    assert(last >= 1 and last <= 1000);
+}
+
+auto main() -> int
+{
+    check_failed_candidates<limit_t>();
+    // Nullable type reports failed candidate instead of storing null and doesn't throw
+    check_failed_candidates<nullable_limit_t>();
+    static_assert(noexcept(std::declval<ct::atomic<nullable_limit_t> &>().compare_exchange(
+        std::declval<nullable_limit_t &>(), 0
+    )));
+    check_concurrent_updates();
+}
@@ -0,0 +1,76 @@
+#include <cassert>
+#include <concepts>
+#include <stdexcept>
+#include <utility>
+
+#include <constrained_type.hpp>
+
+using percent_t = ct::bounded<int, 0, 100>;
+using bonus_t = ct::bounded<int, 0, 50>;
+using delta_t = ct::bounded<int, -10, 20>;
+using divisor_t = ct::bounded<int, -4, -2>;
+using sampled_percent_t = ct::basic_constrained_type<
+    int, ct::default_traits<int>, ct::configuration_point{.check_policy = ct::check_policy::sampled, .sample_rate = 2}, ct::in_range<0, 100>
+>;
+
+template <typename C, int Lo, int Hi>
+inline constexpr bool bounded_by = std::same_as<C, ct::bounded<int, Lo, Hi>>;
+
+// Result intervals are computed from the corners of operand intervals
+static_assert(bounded_by<decltype(percent_t{} + bonus_t{}), 0, 150>);
+static_assert(bounded_by<decltype(percent_t{} - delta_t{}), -20, 110>);
+static_assert(bounded_by<decltype(delta_t{} * delta_t{}), -200, 400>);
+static_assert(bounded_by<decltype(percent_t{} / divisor_t{}), -50, 0>);
+static_assert(bounded_by<decltype(delta_t{} / divisor_t{}), -10, 5>);
+static_assert(bounded_by<decltype(-delta_t{}), -20, 10>);
+static_assert(bounded_by<decltype(percent_t{} * ct::constant<2>), 0, 200>);
+static_assert(bounded_by<decltype(ct::clamp<10, 60>(bonus_t{})), 10, 50>);
+static_assert(bounded_by<decltype(ct::clamp<-5, 5>(delta_t{})), -5, 5>);
+static_assert(bounded_by<decltype(ct::clamp<0, 10>(42)), 0, 10>);
+
+// Results of checked operands are trusted, sampled operands make the result checked
+static_assert(noexcept(std::declval<percent_t const &>() + std::declval<bonus_t const &>()));
+static_assert(not noexcept(std::declval<sampled_percent_t const &>() + std::declval<sampled_percent_t const &>()));
+
+// Operators are usable in constant expressions
+static_assert(*(percent_t{70} + bonus_t{40}) == 110);
+
+auto main() -> int
+{
+    percent_t const percent{70};
+    bonus_t const bonus{40};
+    delta_t const delta{-7};
+    divisor_t const divisor{-3};
+
+    assert(*(percent + bonus) == 110);
+    assert(*(percent - delta) == 77);
+    assert(*(delta * delta) == 49);
+    assert(*(percent / divisor) == -23);
+    assert(*(delta / divisor) == 2);
+    assert(*(-delta) == 7);
+    assert(*(percent * ct::constant<2>) == 140);
+    assert((*ct::clamp<10, 60>(percent) == 60));
+    assert((*ct::clamp<10, 60>(bonus) == 40));
+    assert((*ct::clamp<-5, 5>(delta) == -5));
+    assert((*ct::clamp<0, 10>(42) == 10));
+
+    // The result is widened implicitly
+    ct::bounded<int, -100, 200> const wide = percent + bonus;
+    assert(*wide == 110);
+
+    // The first construction is checked, the second one is skipped by sampling and may hold a value out of range
+    sampled_percent_t const checked{50};
+    sampled_percent_t const unchecked{500};
+
+    // Result type is sampled as well, its first construction is checked
+    bool thrown = false;
+    try
+    {
+        [[maybe_unused]] auto const result = checked + unchecked;
+    }
+    catch (std::logic_error const &)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+}
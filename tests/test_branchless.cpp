@@ -0,0 +1,45 @@
+#include <cassert>
+#include <utility>
+
+#include <constrained_type.hpp>
+
+inline int calls = 0;
+
+constexpr auto counted_positive = [](int const * x) {
+    ++calls;
+    return *x > 0;
+};
+
+constexpr auto branchless = ct::configuration_point{.branchless_checks = true};
+
+template <auto... Constraints>
+using checked_t = ct::basic_constrained_type<int const *, ct::default_traits<int const *>, branchless, Constraints...>;
+
+static_assert(ct::cheap_combinator<std::remove_cv_t<decltype(ct::gt<0>)>>);
+static_assert(ct::cheap_combinator<std::remove_cv_t<decltype(ct::in_range<1, 10>)>>);
+static_assert(ct::cheap_combinator<std::remove_cv_t<decltype(ct::one_of<1, 2, 3>)>>);
+static_assert(ct::cheap_combinator<std::remove_cv_t<decltype(ct::neq<nullptr>)>>);
+static_assert(not ct::cheap_combinator<std::remove_cv_t<decltype(ct::gt<ct::lt<0>>)>>);
+static_assert(not ct::cheap_combinator<std::remove_cv_t<decltype(ct::memoized<counted_positive>)>>);
+
+// More than 64 constraints are checked branchless too
+template <std::size_t... I>
+auto many_constraints(std::index_sequence<I...>)
+    -> ct::basic_constrained_type<int, ct::default_traits<int>, branchless, ct::neq<static_cast<int>(I) + 1000>...>;
+
+using many_t = decltype(many_constraints(std::make_index_sequence<100>{}));
+
+auto main() -> int
+{
+    // Expensive constraint isn't evaluated after failed one, so null pointer is never dereferenced
+    using pointer_t = checked_t<ct::neq<nullptr>, counted_positive>;
+    int const one = 1;
+    pointer_t valid{&one};
+    assert(calls == 1);
+    assert(not ct::try_make<pointer_t>(nullptr).has_value());
+    assert(calls == 1);
+
+    assert(ct::try_make<many_t>(5).has_value());
+    auto const failed = ct::try_make<many_t>(1070);
+    assert(not failed.has_value() and failed.error().index == 70);
+}
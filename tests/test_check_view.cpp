@@ -0,0 +1,105 @@
+#include <cassert>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <constrained_type.hpp>
+
+struct string_traits
+{
+    using value_type = std::string;
+    static constexpr bool is_nullable = false;
+    using check_view_type = std::string_view;
+};
+
+struct vector_traits
+{
+    using value_type = std::vector<int>;
+    static constexpr bool is_nullable = false;
+    using check_view_type = std::span<int const>;
+};
+
+template <typename Trait, auto... Constraints>
+using viewed_t = ct::basic_constrained_type<typename Trait::value_type, Trait, ct::configuration_point{}, Constraints...>;
+
+constexpr auto not_bang = [](std::string_view s) { return not s.ends_with('!'); };
+constexpr auto has_front = [](auto const & s) { return s.front() != '-'; };
+constexpr auto all_positive = [](auto const & xs) {
+    for (auto x : xs)
+        if (x <= 0)
+            return false;
+    return true;
+};
+
+// Member pointer projections and generic lambdas compile, but are checked on the value
+using length_t = viewed_t<string_traits, ct::gt<&std::string::length, 3>, ct::lt<&std::string::size, 10>>;
+static_assert(ct::detail::view_constraints<string_traits, length_t::constraint_pack>::on_view::size == 0);
+
+using mixed_t = viewed_t<string_traits, has_front, ct::length_in<2, 8>, not_bang>;
+using mixed_split = ct::detail::view_constraints<string_traits, mixed_t::constraint_pack>;
+static_assert(mixed_split::on_view::size == 2 and mixed_split::on_value::size == 1);
+
+using numbers_t = viewed_t<vector_traits, all_positive, ct::gt<&std::vector<int>::size, 0>>;
+static_assert(ct::detail::view_constraints<vector_traits, numbers_t::constraint_pack>::on_view::size == 0);
+
+inline int view_calls = 0;
+inline int value_calls = 0;
+
+constexpr auto counted_short = [](std::string_view s) {
+    ++view_calls;
+    return s.size() < 5;
+};
+constexpr auto counted_front = [](auto const & s) {
+    ++value_calls;
+    return s.front() != '-';
+};
+
+using value_first_t = viewed_t<string_traits, counted_front, counted_short>;
+using view_first_t = viewed_t<string_traits, counted_short, counted_front>;
+
+// Rejected view is checked once, value is constructed only to check preceding constraints
+void check_rejection_path()
+{
+    assert(value_first_t::try_make("abcdef").error().index == 1);
+    assert(view_calls == 1 and value_calls == 1);
+
+    assert(value_first_t::try_make("-abcdef").error().index == 0);
+    assert(view_calls == 2 and value_calls == 2);
+
+    assert(view_first_t::try_make("-abcdef").error().index == 0);
+    assert(view_calls == 3 and value_calls == 2);
+
+    assert(view_first_t::try_make("-abc").error().index == 1);
+    assert(view_calls == 4 and value_calls == 3);
+}
+
+int main()
+{
+    check_rejection_path();
+
+    length_t const ok{"abcd"};
+    assert(ok->size() == 4);
+    assert(length_t::try_make("abc").error().index == 0);
+    assert(length_t::try_make("abcdefghijk").error().index == 1);
+
+    mixed_t const mixed{"abc"};
+    assert(mixed->size() == 3);
+    assert(mixed_t::try_make("-bc").error().index == 0);
+    assert(mixed_t::try_make("a").error().index == 1);
+    assert(mixed_t::try_make("-").error().index == 0);
+    assert(mixed_t::try_make("abc!").error().index == 2);
+    try
+    {
+        mixed_t bad{"abc!"};
+        assert(false);
+    }
+    catch (std::logic_error const &)
+    {
+    }
+
+    numbers_t const numbers{std::vector<int>{1, 2, 3}};
+    assert(numbers->size() == 3);
+    assert(numbers_t::try_make(std::vector<int>{1, -2}).error().index == 0);
+}
@@ -0,0 +1,105 @@
+#include <cassert>
+#include <list>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <constrained_type.hpp>
+
+using positive_t = ct::constrained_type<int, ct::gt<0>>;
+using positives_t = ct::constrained_vector_for<positive_t>;
+using sampled_positive_t = ct::basic_constrained_type<
+    int, ct::default_traits<int>, ct::configuration_point{.check_policy = ct::check_policy::sampled, .sample_rate = 2}, ct::gt<0>
+>;
+
+inline constexpr auto not_empty = [](std::string const & x) { return not x.empty(); };
+using names_t = ct::constrained_vector<std::string, not_empty>;
+
+template <typename Operation>
+auto throws(Operation operation) -> bool
+{
+    try
+    {
+        operation();
+    }
+    catch (std::logic_error const &)
+    {
+        return true;
+    }
+    return false;
+}
+
+// Every failed insertion leaves the vector equal to its state before the insertion
+template <typename Vector, typename Operation>
+void check_unchanged(Vector & values, Operation operation)
+{
+    auto const before = values;
+    assert(throws([&] { operation(values); }));
+    assert(values == before);
+}
+
+void check_ints()
+{
+    positives_t values{1, 2, 3};
+
+    // Failures in the first, middle and last inserted element, with sizes around SIMD chunks
+    for (std::size_t size : {1uz, 15uz, 16uz, 17uz, 33uz, 64uz, 65uz, 100uz})
+    {
+        for (std::size_t failed : {0uz, size / 2, size - 1})
+        {
+            std::vector<int> inserted(size, 7);
+            inserted[failed] = 0;
+            check_unchanged(values, [&](positives_t & x) { x.insert_range(x.cbegin() + 1, inserted); });
+            check_unchanged(values, [&](positives_t & x) { x.append_range(inserted); });
+            check_unchanged(values, [&](positives_t & x) { x.append_range(std::list<int>(inserted.begin(), inserted.end())); });
+            check_unchanged(values, [&](positives_t & x) { x.insert(x.cbegin(), inserted.begin(), inserted.end()); });
+        }
+    }
+    check_unchanged(values, [](positives_t & x) { x.append_range(std::views::iota(-5, 5)); });
+    check_unchanged(values, [](positives_t & x) { x.emplace_back(-1); });
+    check_unchanged(values, [](positives_t & x) { x.push_back(0); });
+    check_unchanged(values, [](positives_t & x) { x.insert(x.cbegin(), 3uz, 0); });
+    check_unchanged(values, [](positives_t & x) { x.set(1, 0); });
+
+    assert(not values.try_push_back(0));
+    assert(values.size() == 3);
+
+    values.append_range(std::vector{4, 5});
+    values.emplace_back(6);
+    values.set(0, 10);
+    assert((values == positives_t{10, 2, 3, 4, 5, 6}));
+}
+
+void check_strings()
+{
+    names_t names{"a", "b"};
+    check_unchanged(names, [](names_t & x) { x.insert_range(x.cbegin() + 1, std::vector<std::string>{"c", "", "d"}); });
+    check_unchanged(names, [](names_t & x) { x.append_range(std::vector<std::string>{"c", "d", ""}); });
+    check_unchanged(names, [](names_t & x) { x.emplace_back(); });
+    check_unchanged(names, [](names_t & x) { x.set(0, ""); });
+    assert((names == names_t{"a", "b"}));
+}
+
+// Values of sampled types may be unchecked, so they are checked on push_back
+void check_sampled_push_back()
+{
+    sampled_positive_t const checked{1};
+    sampled_positive_t const unchecked{0};
+
+    positives_t values;
+    values.push_back(checked);
+    check_unchanged(values, [&](positives_t & x) { x.push_back(unchecked); });
+    assert((values == positives_t{1}));
+
+    // Checked types covering the constraints are pushed as is
+    values.push_back(positive_t{2});
+    assert((values == positives_t{1, 2}));
+}
+
+auto main() -> int
+{
+    check_ints();
+    check_strings();
+    check_sampled_push_back();
+}
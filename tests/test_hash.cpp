@@ -0,0 +1,48 @@
+#include <cassert>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+
+#include <constrained_type.hpp>
+
+using user_id_t = ct::constrained_type<int, ct::gt<0>>;
+using name_t = ct::constrained_type<std::string, ct::length_in<1, 32>>;
+
+using id_hash = ct::transparent_hash<user_id_t>;
+using id_equal = ct::transparent_equal<user_id_t>;
+using name_hash = ct::transparent_hash<name_t>;
+
+// Arithmetic lookup keys must match raw value type exactly
+static_assert(std::is_invocable_v<id_hash, user_id_t>);
+static_assert(std::is_invocable_v<id_hash, int>);
+static_assert(std::is_invocable_v<id_hash, int const &>);
+static_assert(not std::is_invocable_v<id_hash, double>);
+static_assert(not std::is_invocable_v<id_hash, long long>);
+static_assert(not std::is_invocable_v<id_hash, short>);
+static_assert(not std::is_invocable_v<id_hash, bool>);
+static_assert(not std::is_invocable_v<id_equal, user_id_t, double>);
+static_assert(not std::is_invocable_v<id_equal, long long, user_id_t>);
+
+// Strings are looked up through std::string_view
+static_assert(std::is_invocable_v<name_hash, name_t>);
+static_assert(std::is_invocable_v<name_hash, std::string>);
+static_assert(std::is_invocable_v<name_hash, std::string_view>);
+static_assert(std::is_invocable_v<name_hash, char const *>);
+static_assert(std::is_invocable_v<name_hash, char const (&)[6]>);
+static_assert(not std::is_invocable_v<name_hash, int>);
+static_assert(not std::is_invocable_v<name_hash, char>);
+
+auto main() -> int
+{
+    std::unordered_set<user_id_t, id_hash, id_equal> ids{user_id_t{1}, user_id_t{2}};
+    assert(ids.contains(1));
+    assert(ids.contains(user_id_t{2}));
+    assert(not ids.contains(3));
+
+    std::unordered_set<name_t, name_hash, ct::transparent_equal<name_t>> names{name_t{"alice"}};
+    assert(names.contains("alice"));
+    assert(names.contains(std::string_view{"alice"}));
+    assert(names.contains(std::string{"alice"}));
+    assert(not names.contains("Bad!"));
+}
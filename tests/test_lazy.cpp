@@ -0,0 +1,39 @@
+#include <cassert>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <constrained_type.hpp>
+
+constexpr auto positive = [](std::optional<int> const & x) { return x and *x > 0; };
+
+using lazy_id_t = ct::lazy_constrained_type<int, ct::gt<0>>;
+using lazy_nullable_id_t = ct::lazy_constrained_type<std::optional<int>, positive>;
+
+static_assert(std::is_trivially_copyable_v<lazy_id_t>);
+
+auto main() -> int
+{
+    // The first access of const values shared between threads
+    for (int round = 0; round < 100; ++round)
+    {
+        lazy_id_t const id{round + 1};
+        lazy_nullable_id_t const valid{round + 1};
+        lazy_nullable_id_t const invalid{-round};
+
+        std::vector<std::jthread> readers;
+        for (int i = 0; i < 4; ++i)
+        {
+            readers.emplace_back([&] {
+                assert(*id == round + 1);
+                assert(valid == round + 1);
+                assert(invalid == std::nullopt);
+            });
+        }
+    }
+
+    lazy_nullable_id_t const invalid{0};
+    ct::validate_all(invalid);
+    assert(invalid == std::nullopt);
+}
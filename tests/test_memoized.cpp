@@ -0,0 +1,46 @@
+#include <cassert>
+#include <string>
+#include <string_view>
+
+#include <constrained_type.hpp>
+
+inline int calls = 0;
+
+constexpr auto non_empty = [](std::string_view s) {
+    ++calls;
+    return not s.empty();
+};
+
+constexpr auto cached_non_empty = ct::memoized<non_empty, 16>;
+
+using name_t = ct::constrained_type<std::string, cached_non_empty>;
+
+auto main() -> int
+{
+    // Short keys are cached
+    std::string const short_key = "tenant";
+    name_t a{short_key};
+    name_t b{short_key};
+    assert(calls == 1);
+    assert((ct::memo_stats<cached_non_empty, std::string>().hits == 1));
+
+    // Cached copy doesn't refer to the original string
+    std::string reused = "alice";
+    name_t c{reused};
+    reused = "bob__";
+    name_t d{reused};
+    assert(calls == 3);
+
+    // Keys longer than 64 characters are evaluated every time
+    std::string const long_key(65, 'x');
+    name_t e{long_key};
+    name_t f{long_key};
+    assert(calls == 5);
+    auto const stats = ct::memo_stats<cached_non_empty, std::string>();
+    assert(stats.hits == 1 and stats.misses == 5);
+
+    // View keys are cached separately
+    assert(ct::apply<cached_non_empty>(std::string_view{"x"}));
+    assert(ct::apply<cached_non_empty>(std::string_view{"x"}));
+    assert(calls == 6);
+}
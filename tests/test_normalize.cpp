@@ -0,0 +1,49 @@
+#include <cassert>
+#include <concepts>
+
+#include <constrained_type.hpp>
+
+inline constexpr auto even = [](int x) { return x % 2 == 0; };
+
+template <auto... Constraints>
+using normalized = ct::normalize_constraint_pack<int, ct::value_pack<Constraints...>>;
+
+// Bounds are folded into the tightest interval, duplicates are removed
+static_assert(std::same_as<normalized<ct::gt<0>, ct::gt<5>, ct::lt<100>, ct::lt<42>, ct::gt<0>>, ct::value_pack<ct::gt<5>, ct::lt<42>>>);
+static_assert(std::same_as<normalized<ct::ge<5>, ct::gt<5>, ct::le<42>, ct::lt<42>>, ct::value_pack<ct::gt<5>, ct::lt<42>>>);
+static_assert(std::same_as<normalized<ct::lt<100>, ct::ge<0>>, ct::value_pack<ct::ge<0>, ct::lt<100>>>);
+
+// Bounds go first, other constraints keep their order
+static_assert(std::same_as<normalized<even, ct::lt<42>, ct::gt<0>, ct::lt<50>>, ct::value_pack<ct::gt<0>, ct::lt<42>, even>>);
+
+// eq absorbs bounds it satisfies
+static_assert(std::same_as<normalized<ct::gt<0>, ct::eq<7>, ct::lt<100>>, ct::value_pack<ct::eq<7>>>);
+static_assert(std::same_as<normalized<ct::ge<7>, ct::le<7>, ct::eq<7>, even>, ct::value_pack<ct::eq<7>, even>>);
+static_assert(std::same_as<normalized<ct::eq<7>, ct::eq<7>>, ct::value_pack<ct::eq<7>>>);
+
+// Normalization of constrained type replaces its pack
+using composed_t = ct::constrained_type<int, ct::gt<0>, ct::gt<5>, ct::lt<100>, ct::lt<42>, ct::gt<0>>;
+static_assert(std::same_as<composed_t::normalize_constraints, ct::constrained_type<int, ct::gt<5>, ct::lt<42>>>);
+
+// With normalize_constraints the type is kept, violation index refers to its original pack
+using normalized_t = ct::basic_constrained_type<
+    int, ct::default_traits<int>, ct::configuration_point{.normalize_constraints = true},
+    ct::gt<0>, ct::gt<5>, ct::lt<100>, even, ct::lt<42>, ct::gt<0>
+>;
+static_assert(normalized_t::constraint_pack::size == 6);
+
+auto main() -> int
+{
+    assert(normalized_t::try_make(10));
+    assert(normalized_t::try_make(3).error().index == 1);
+    assert(normalized_t::try_make(0).error().index == 1);
+    assert(normalized_t::try_make(50).error().index == 4);
+    assert(normalized_t::try_make(7).error().index == 3);
+
+    using equal_t = ct::basic_constrained_type<
+        int, ct::default_traits<int>, ct::configuration_point{.normalize_constraints = true},
+        ct::gt<0>, even, ct::eq<8>
+    >;
+    assert(equal_t::try_make(8));
+    assert(equal_t::try_make(6).error().index == 2);
+}
@@ -0,0 +1,43 @@
+#include <cassert>
+#include <optional>
+
+#include <constrained_type.hpp>
+
+using id_t_ = ct::constrained_type<int, ct::gt<0>>;
+using pointer_t = ct::constrained_type<int const *, ct::neq<nullptr>>;
+using sampled_id_t = ct::basic_constrained_type<
+    int, ct::default_traits<int>, ct::configuration_point{.check_policy = ct::check_policy::sampled, .sample_rate = 2}, ct::gt<0>
+>;
+using debug_id_t = ct::basic_constrained_type<
+    int, ct::default_traits<int>, ct::configuration_point{.check_policy = ct::check_policy::debug_only}, ct::gt<0>
+>;
+using lazy_id_t = ct::lazy_constrained_type<int, ct::gt<0>>;
+
+// Checked types store empty state in a niche
+static_assert(sizeof(ct::optional<id_t_>) == sizeof(int));
+static_assert(sizeof(ct::optional<pointer_t>) == sizeof(int const *));
+
+// Types holding unchecked values may hold the niche, so they fall back to std::optional
+static_assert(not ct::detail::niche<sampled_id_t>::exists);
+static_assert(not ct::detail::niche<lazy_id_t>::exists);
+static_assert(ct::detail::niche<debug_id_t>::exists == ct::debug_build);
+static_assert(sizeof(ct::optional<sampled_id_t>) == sizeof(std::optional<int>));
+
+auto main() -> int
+{
+    ct::optional<id_t_> id;
+    assert(not id.has_value());
+    id = id_t_{42};
+    assert(id.has_value() and **id == 42);
+    id = std::nullopt;
+    assert(not id);
+
+    // The first construction is checked, the second one is skipped by sampling
+    sampled_id_t const checked{1};
+    sampled_id_t const unchecked{0};
+    ct::optional<sampled_id_t> const sampled{unchecked};
+    assert(sampled.has_value());
+
+    ct::optional<lazy_id_t> const lazy{lazy_id_t{0}};
+    assert(lazy.has_value());
+}
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <constrained_type.hpp>
+
+constexpr auto positive = [](int x) { return x > 0; };
+constexpr auto negative = [](int x) { return x < 0; };
+
+// Small threshold and grains, so test ranges are split into many chunks
+constexpr auto even_chunks = ct::execution{.threshold = 1, .grain = 1024};
+constexpr auto odd_chunks = ct::execution{.threshold = 1, .grain = 777};
+
+template <ct::execution Policy>
+void check_against_sequential(std::vector<int> const & data)
+{
+    assert((ct::all_of<positive, Policy>(data) == std::ranges::all_of(data, positive)));
+    assert((ct::any_of<negative, Policy>(data) == std::ranges::any_of(data, negative)));
+    assert((ct::none_of<negative, Policy>(data) == std::ranges::none_of(data, negative)));
+}
+
+void check_sizes()
+{
+    for (std::size_t size : {0UZ, 1UZ, 777UZ, 1024UZ, 4096UZ, 4097UZ, 10'000UZ})
+    {
+        std::vector<int> data(size, 1);
+        check_against_sequential<even_chunks>(data);
+        check_against_sequential<odd_chunks>(data);
+        if (size == 0)
+            continue;
+
+        // Failure in the first, a middle and the last chunk
+        for (std::size_t at : {0UZ, size / 2, size - 1})
+        {
+            data[at] = -1;
+            check_against_sequential<even_chunks>(data);
+            check_against_sequential<odd_chunks>(data);
+            data[at] = 1;
+        }
+    }
+}
+
+constexpr auto throwing = [](int x) {
+    if (x == -7)
+        throw std::runtime_error{"rejected"};
+    return true;
+};
+
+// Pred runs parallel check itself, so the nested call must run inline instead of waiting for busy pool
+inline std::vector<int> const inner(4096, 1);
+
+constexpr auto nested = [](int) { return ct::all_of<positive, even_chunks>(inner); };
+
+auto main() -> int
+{
+    for (std::size_t threads : {1UZ, 2UZ, 4UZ, 8UZ})
+    {
+        ct::set_parallel_concurrency(threads);
+        assert(ct::parallel_concurrency() == threads);
+        check_sizes();
+
+        std::vector<int> data(10'000, 1);
+        data.back() = -7;
+        bool thrown = false;
+        try
+        {
+            static_cast<void>(ct::all_of<throwing, odd_chunks>(data));
+        }
+        catch (std::runtime_error const &)
+        {
+            thrown = true;
+        }
+        assert(thrown);
+
+        std::vector<int> const outer(2048, 1);
+        assert((ct::all_of<nested, odd_chunks>(outer)));
+
+        // Concurrent callers either get the pool or run inline
+        std::vector<int> valid(50'000, 1);
+        std::vector<int> invalid(50'000, 1);
+        invalid[49'999] = -1;
+        {
+            std::vector<std::jthread> callers;
+            for (int i = 0; i < 4; ++i)
+            {
+                callers.emplace_back([&] {
+                    for (int k = 0; k < 20; ++k)
+                    {
+                        assert((ct::all_of<positive, even_chunks>(valid)));
+                        assert((not ct::all_of<positive, odd_chunks>(invalid)));
+                    }
+                });
+            }
+        }
+    }
+
+    // Shrinking to inline checks and growing back
+    ct::set_parallel_concurrency(1);
+    check_sizes();
+    ct::set_parallel_concurrency(4);
+    check_sizes();
+}
@@ -0,0 +1,60 @@
+#include <cassert>
+#include <iterator>
+#include <vector>
+
+#include <constrained_type.hpp>
+
+using port_t = ct::constrained_type<int, ct::in_range<1, 65535>>;
+using signed_t = ct::constrained_type<int, ct::in_range<-100, 100>>;
+using real_t = ct::constrained_type<double, ct::gt<0.0>>;
+
+// Token cut by the end of a chunk is left for the next chunk
+template <typename C>
+auto deferred_at(std::string_view chunk, std::size_t consumed, std::size_t count) -> bool
+{
+    std::vector<C> out;
+    auto const result = ct::parse_many<C>(chunk, std::back_inserter(out), ',', false);
+    return not result.error and result.consumed == consumed and result.count == count;
+}
+
+int main()
+{
+    // Sign cut
+    assert(deferred_at<signed_t>("1,2,-", 4, 2));
+    // Exponent cut
+    assert(deferred_at<real_t>("1.5,2e", 4, 1));
+    assert(deferred_at<real_t>("1.5,2e-", 4, 1));
+    // Decimal point cut
+    assert(deferred_at<real_t>("1.5,2.", 4, 1));
+    // Complete token without trailing separator may still continue
+    assert(deferred_at<port_t>("10,20,3", 6, 2));
+    assert(deferred_at<port_t>("10,20,", 6, 2));
+
+    // The next chunk completes deferred token
+    {
+        std::vector<signed_t> out;
+        std::string_view const text = "1,2,-12,7";
+        auto first = ct::parse_many<signed_t>(text.substr(0, 5), std::back_inserter(out), ',', false);
+        auto second = ct::parse_many<signed_t>(text.substr(first.consumed), std::back_inserter(out));
+        assert(not second.error and out.size() == 4 and *out[2] == -12 and *out[3] == 7);
+    }
+
+    // Invalid tokens followed by a separator are errors even in non-final chunk
+    {
+        std::vector<port_t> out;
+        auto const result = ct::parse_many<port_t>("1,-,3", std::back_inserter(out), ',', false);
+        assert(result.error and result.error->code == ct::parse_errc::invalid_argument and result.consumed == 2);
+    }
+    {
+        std::vector<real_t> out;
+        auto const result = ct::parse_many<real_t>("1.5,2e,3", std::back_inserter(out), ',', false);
+        assert(result.error and result.error->code == ct::parse_errc::trailing_characters and result.consumed == 4);
+    }
+
+    // Final chunk reports cut tokens
+    {
+        std::vector<signed_t> out;
+        auto const result = ct::parse_many<signed_t>("1,2,-", std::back_inserter(out));
+        assert(result.error and result.error->code == ct::parse_errc::invalid_argument and result.consumed == 4);
+    }
+}
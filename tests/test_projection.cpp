@@ -0,0 +1,52 @@
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <string>
+
+#include <constrained_type.hpp>
+
+inline std::size_t projections = 0;
+
+inline constexpr auto counted_size = [](std::string const & x) {
+    ++projections;
+    return x.size();
+};
+
+inline constexpr auto not_blank = [](std::string const & x) { return x.find_first_not_of(' ') != std::string::npos; };
+
+using shared_t = ct::constrained_type<std::string, ct::gt<counted_size, 10>, ct::lt<counted_size, 20>>;
+using explicit_t = ct::constrained_type<std::string, ct::proj<counted_size, ct::gt<10>, ct::lt<20>>>;
+using mixed_t = ct::constrained_type<std::string, ct::ge<counted_size, 5>, ct::proj<counted_size, ct::neq<12>>>;
+using indexed_t = ct::constrained_type<std::string, ct::gt<counted_size, 10>, not_blank, ct::lt<counted_size, 20>>;
+
+static_assert(std::same_as<ct::projection_cache<std::string, shared_t::constraint_pack>, ct::detail::projection_cache<std::string, ct::value_pack<counted_size>>>);
+static_assert(std::same_as<ct::projection_cache<std::string, explicit_t::constraint_pack>, ct::detail::projection_cache<std::string, ct::value_pack<>>>);
+
+// Runs f and returns how many times the projection was computed
+template <typename F>
+auto count_projections(F f) -> std::size_t
+{
+    projections = 0;
+    f();
+    return projections;
+}
+
+auto main() -> int
+{
+    std::string const valid(15, 'a');
+    std::string const too_long(25, 'a');
+    std::string const blank(15, ' ');
+
+    assert(count_projections([&] { shared_t const x{valid}; }) == 1);
+    assert(count_projections([&] { assert(not shared_t::try_make(too_long)); }) == 1);
+    assert(count_projections([&] { explicit_t const x{valid}; }) == 1);
+    assert(count_projections([&] { mixed_t const x{valid}; }) == 1);
+
+    // Violation index is the index of the failed constraint in the original pack
+    assert(count_projections([&] { assert(shared_t::try_make(std::string(5, 'a')).error().index == 0); }) == 1);
+    assert(count_projections([&] { assert(shared_t::try_make(too_long).error().index == 1); }) == 1);
+    assert(count_projections([&] { assert(mixed_t::try_make(std::string(12, 'a')).error().index == 1); }) == 1);
+    assert(count_projections([&] { assert(indexed_t::try_make(too_long).error().index == 2); }) == 1);
+    assert(count_projections([&] { assert(indexed_t::try_make(blank).error().index == 1); }) == 1);
+    assert(count_projections([&] { assert(indexed_t::try_make(valid)); }) == 1);
+}
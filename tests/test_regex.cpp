@@ -0,0 +1,36 @@
+#include <cassert>
+#include <string_view>
+
+#include <constrained_type.hpp>
+
+constexpr auto identifier = ct::matches<"[A-Za-z_]\\w*">;
+constexpr auto hex_token = ct::matches<"(0x)?[0-9a-fA-F]{8,64}">;
+constexpr auto ends_abb = ct::matches<"(a|b)*abb(a|b){3}">;
+
+static_assert(identifier(std::string_view{"_name1"}));
+static_assert(not identifier(std::string_view{"1name"}));
+static_assert(hex_token(std::string_view{"0xdeadBEEF"}));
+static_assert(not hex_token(std::string_view{"0xdeadBEE"}));
+
+// Both tables are derived from the same compiled automaton
+using hex_dfa = ct::detail::regex::dfa<"(0x)?[0-9a-fA-F]{8,64}">;
+static_assert(hex_dfa::value.next.size() == hex_dfa::states * hex_dfa::classes);
+static_assert(hex_dfa::states == 68);
+
+auto main() -> int
+{
+    assert(identifier(std::string_view{"snake_case"}));
+    assert(not identifier(std::string_view{""}));
+
+    assert(hex_token(std::string_view{"0123456789abcdef"}));
+    assert(not hex_token(std::string_view{"0x"}));
+    char const long_hex[] = "0x0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef";
+    assert(hex_token(std::string_view{long_hex}));
+    assert(not hex_token(std::string_view{long_hex}.substr(0, 9)));
+    assert(not hex_token(std::string_view{"0x0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef0"}));
+
+    assert(ends_abb(std::string_view{"ababbaba"}));
+    assert(ends_abb(std::string_view{"abbbbb"}));
+    assert(not ends_abb(std::string_view{"abbbb"}));
+    assert(not ends_abb(std::string_view{"abab"}));
+}
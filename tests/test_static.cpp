@@ -0,0 +1,35 @@
+#include <array>
+#include <cassert>
+#include <concepts>
+
+#include <constrained_type.hpp>
+
+using port_t = ct::constrained_type<int, ct::gt<0>, ct::le<65535>>;
+enum class scheme { none, http, https };
+using scheme_t = ct::constrained_type<scheme, ct::neq<scheme::none>>;
+
+// Tables and constants are validated at compile time and constant initialized
+static constexpr auto routes = ct::make_static_table<port_t, std::array{80, 443, 8080}>();
+constinit auto http = port_t::from_constant<80>();
+constinit auto https = ct::make_static<port_t, 443>();
+static constexpr auto schemes = ct::make_static_table<scheme_t, std::array{scheme::http, scheme::https}>();
+
+static_assert(std::same_as<decltype(routes), std::array<port_t, 3> const>);
+static_assert(*routes[0] == 80 and *routes[1] == 443 and *routes[2] == 8080);
+static_assert(*port_t::from_constant<65535>() == 65535);
+static_assert(ct::make_static_table<port_t, std::array<int, 0>{}>().empty());
+static_assert(*schemes[1] == scheme::https);
+
+auto main() -> int
+{
+    int sum = 0;
+    for (auto const & route : routes)
+        sum += *route;
+    assert(sum == 80 + 443 + 8080);
+
+    assert(*http == 80 and *https == 443);
+    http = https;
+    assert(*http == 443);
+
+    assert(*schemes[0] == scheme::http);
+}
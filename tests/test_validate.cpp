@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <constrained_type.hpp>
+
+inline constexpr auto even = [](int x) { return x % 2 == 0; };
+
+using age_t = ct::constrained_type<int, ct::ge<0>, ct::lt<150>>;
+using code_t = ct::constrained_type<std::int8_t, ct::in_range<std::int8_t{-20}, std::int8_t{20}>, ct::neq<std::int8_t{0}>>;
+using port_t = ct::constrained_type<std::uint16_t, ct::not_<ct::one_of<std::uint16_t{0}, std::uint16_t{22}>>>;
+using ratio_t = ct::constrained_type<double, ct::ge<0.0>, ct::le<1.0>>;
+using offset_t = ct::constrained_type<std::int64_t, ct::gt<std::int64_t{-100}>>;
+using even_age_t = ct::constrained_type<int, ct::ge<0>, even>;
+
+#if defined(CONSTRAINED_TYPE_VECTOR_KERNELS)
+static_assert(ct::is_vectorized<age_t>);
+static_assert(ct::is_vectorized<code_t>);
+static_assert(ct::is_vectorized<port_t>);
+static_assert(ct::is_vectorized<ratio_t>);
+static_assert(ct::is_vectorized<offset_t>);
+#endif
+static_assert(not ct::is_vectorized<even_age_t>);
+
+template <typename C>
+auto satisfies(typename C::value_type const & value) -> bool
+{
+    return C::try_make(value).has_value();
+}
+
+// validate uses the widest kernel supported by current CPU, so each kernel is also compared directly
+template <typename C>
+void check_kernels([[maybe_unused]] std::span<typename C::value_type const> values)
+{
+#if defined(CONSTRAINED_TYPE_VECTOR_KERNELS)
+    using kernel = ct::detail::bulk_kernel_for<C>;
+    if constexpr (kernel::vectorized)
+    {
+        for (std::size_t offset = 0; offset + kernel::chunk_size <= values.size(); offset += kernel::chunk_size)
+        {
+            auto const bits = kernel::scalar_chunk(values.data() + offset);
+            assert(kernel::sse2_chunk(values.data() + offset) == bits);
+    #if defined(CONSTRAINED_TYPE_AVX2_DISPATCH)
+            if (__builtin_cpu_supports("avx2"))
+                assert(kernel::avx2_chunk(values.data() + offset) == bits);
+    #endif
+        }
+    }
+#endif
+}
+
+// Sizes around lanes of 16 and 32 byte vectors and 64 element chunks
+inline constexpr std::size_t sizes[] = {0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 129, 200};
+
+template <typename C, typename Generate>
+void check_against_scalar(Generate generate)
+{
+    using value_t = typename C::value_type;
+    std::mt19937 random{42};
+
+    for (std::size_t size : sizes)
+    {
+        std::vector<value_t> values(size);
+        for (auto & value : values)
+            value = generate(random);
+
+        auto const mask = ct::validate<C>(values);
+        std::size_t first = size;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            bool const failed = not satisfies<C>(values[i]);
+            assert(mask.failed(i) == failed);
+            if (failed and first == size)
+                first = i;
+        }
+        assert(ct::validate_first<C>(values) == first);
+        check_kernels<C>(values);
+
+        // Valid values are moved to the front in their original order, failed ones follow
+        std::vector<value_t> expected_valid;
+        std::vector<value_t> expected_failed;
+        for (auto const & value : values)
+            (satisfies<C>(value) ? expected_valid : expected_failed).push_back(value);
+
+        auto partitioned = values;
+        std::size_t const valid = ct::validate_partition<C>(std::span{partitioned});
+        assert(valid == expected_valid.size());
+        assert(std::equal(partitioned.begin(), partitioned.begin() + static_cast<std::ptrdiff_t>(valid), expected_valid.begin()));
+        std::vector<value_t> failed(partitioned.begin() + static_cast<std::ptrdiff_t>(valid), partitioned.end());
+        std::ranges::sort(failed);
+        std::ranges::sort(expected_failed);
+        assert(failed == expected_failed);
+    }
+}
+
+// Every value is valid except the last one, which is in the scalar tail or in the last full chunk
+template <typename C>
+void check_last_failure(typename C::value_type valid, typename C::value_type invalid)
+{
+    for (std::size_t size : sizes)
+    {
+        if (size == 0)
+            continue;
+        std::vector<typename C::value_type> values(size, valid);
+        assert(ct::validate_first<C>(values) == size);
+        values.back() = invalid;
+        assert(ct::validate_first<C>(values) == size - 1);
+        assert(ct::validate_partition<C>(std::span{values}) == size - 1);
+        assert(values.back() == invalid);
+    }
+}
+
+auto main() -> int
+{
+    check_against_scalar<age_t>([](auto & random) { return std::uniform_int_distribution<int>{-10, 160}(random); });
+    check_against_scalar<code_t>([](auto & random) { return static_cast<std::int8_t>(std::uniform_int_distribution<int>{-25, 25}(random)); });
+    check_against_scalar<port_t>([](auto & random) {
+        return static_cast<std::uint16_t>(std::uniform_int_distribution<int>{0, 3}(random) == 0 ? 22 : std::uniform_int_distribution<int>{0, 30}(random));
+    });
+    check_against_scalar<ratio_t>([](auto & random) { return std::uniform_real_distribution<double>{-0.2, 1.2}(random); });
+    check_against_scalar<offset_t>([](auto & random) { return std::uniform_int_distribution<std::int64_t>{-110, -90}(random); });
+    check_against_scalar<even_age_t>([](auto & random) { return std::uniform_int_distribution<int>{-3, 100}(random); });
+
+    check_last_failure<age_t>(20, 150);
+    check_last_failure<code_t>(std::int8_t{1}, std::int8_t{0});
+    check_last_failure<ratio_t>(0.5, 1.5);
+    check_last_failure<offset_t>(0, -100);
+    check_last_failure<even_age_t>(2, 3);
+}